@@ -0,0 +1 @@
+#include <AllocatorLib/allocatorTraits.hpp>
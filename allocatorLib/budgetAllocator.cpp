@@ -0,0 +1 @@
+#include <AllocatorLib/budgetAllocator.hpp>
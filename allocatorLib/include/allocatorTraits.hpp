@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Moon
+{
+
+// Detects allocators that can grow an allocation in place through
+// bool TryExtend(T* ptr, size_t newSize)
+template <typename Allocator, typename = void>
+struct SupportsTryExtend : std::false_type
+{
+};
+
+template <typename Allocator>
+struct SupportsTryExtend<
+    Allocator, std::void_t<decltype(std::declval<Allocator&>().TryExtend(
+                   std::declval<typename Allocator::ValueType*>(), std::declval<size_t>()))>>
+    : std::true_type
+{
+};
+}  // namespace Moon
@@ -1,21 +1,40 @@
 #pragma once
 
 #include <MemoryLib/arena.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 
 namespace Moon
 {
-template <typename T>
+// Every allocation is prefixed with the ArenaChunk it lives in, so Deallocate
+// finds its chunk in O(1) and one allocator (or copies of it) can back any
+// number of live allocations from the same arena.
+// Alignment can be raised above alignof(T), chunks already start 64 byte aligned.
+template <typename T, size_t Alignment = alignof(T)>
 class ArenaAllocator
 {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                  "ArenaAllocator: Alignment must be a power of two and at least alignof(T)");
+
    public:
+    using ValueType = T;
+    static constexpr size_t ALIGNMENT = Alignment;
+
     ArenaAllocator(Arena* arena) : mArena(arena) {}
 
+    template <typename U, size_t OtherAlignment>
+    ArenaAllocator(const ArenaAllocator<U, OtherAlignment>& other) : mArena(other.GetArena())
+    {
+    }
+
     T* Allocate(size_t size);
 
     void Deallocate(T*& ptr);
 
+    // Grows the allocation at ptr to newSize elements without moving it
+    bool TryExtend(T* ptr, size_t newSize);
+
     template <typename... Args>
     void Construct(T* ptr, Args&&... args);
 
@@ -25,9 +44,21 @@ class ArenaAllocator
 
     size_t GetStartingCapacity() const noexcept;
 
+    Arena* GetArena() const noexcept
+    {
+        return mArena;
+    }
+
+   private:
+    static ArenaChunk*& GetChunkPrefix(T* ptr) noexcept;
+
    private:
+    // Keeps the elements aligned behind the chunk pointer
+    static constexpr size_t PREFIX_SIZE = std::max(sizeof(ArenaChunk*), Alignment);
+    static constexpr size_t CHUNK_ALIGNMENT =
+        std::max<size_t>(Alignment, ArenaMemoryBlock::SIZE_ALIGNMENT);
+
     Arena* mArena;
-    ArenaChunk* mCurrentChunk = nullptr;
 };
 }  // namespace Moon
 
@@ -5,45 +5,66 @@
 namespace Moon
 {
 
-template <typename T>
-T* ArenaAllocator<T>::Allocate(size_t size)
+template <typename T, size_t Alignment>
+T* ArenaAllocator<T, Alignment>::Allocate(size_t size)
 {
-    mCurrentChunk = mArena->RequestChunk(size * sizeof(T));
-    return reinterpret_cast<T*>(mCurrentChunk->GetData());
+    auto* chunk = mArena->RequestChunk(PREFIX_SIZE + size * sizeof(T), CHUNK_ALIGNMENT);
+    auto* ptr = reinterpret_cast<T*>(static_cast<std::byte*>(chunk->GetData()) + PREFIX_SIZE);
+    GetChunkPrefix(ptr) = chunk;
+    return ptr;
 }
 
-template <typename T>
-void ArenaAllocator<T>::Deallocate(T*& ptr)
+template <typename T, size_t Alignment>
+void ArenaAllocator<T, Alignment>::Deallocate(T*& ptr)
 {
     if (ptr == nullptr)
     {
         return;
     }
 
-    mArena->ReleaseChunk(mCurrentChunk);
+    mArena->ReleaseChunk(GetChunkPrefix(ptr));
 }
 
-template <typename T>
+template <typename T, size_t Alignment>
+bool ArenaAllocator<T, Alignment>::TryExtend(T* ptr, size_t newSize)
+{
+    auto*& chunk = GetChunkPrefix(ptr);
+    auto* extendedChunk = mArena->TryExtendChunk(chunk, PREFIX_SIZE + newSize * sizeof(T));
+    if (extendedChunk == nullptr)
+    {
+        return false;
+    }
+    chunk = extendedChunk;
+    return true;
+}
+
+template <typename T, size_t Alignment>
+ArenaChunk*& ArenaAllocator<T, Alignment>::GetChunkPrefix(T* ptr) noexcept
+{
+    return *reinterpret_cast<ArenaChunk**>(reinterpret_cast<std::byte*>(ptr) - PREFIX_SIZE);
+}
+
+template <typename T, size_t Alignment>
 template <typename... Args>
-void ArenaAllocator<T>::Construct(T* ptr, Args&&... args)
+void ArenaAllocator<T, Alignment>::Construct(T* ptr, Args&&... args)
 {
     new (ptr) T(std::forward<Args>(args)...);
 }
 
-template <typename T>
-void ArenaAllocator<T>::Destruct(T* ptr) noexcept
+template <typename T, size_t Alignment>
+void ArenaAllocator<T, Alignment>::Destruct(T* ptr) noexcept
 {
     ptr->~T();
 }
 
-template <typename T>
-size_t ArenaAllocator<T>::GetStartingCapacity() const noexcept
+template <typename T, size_t Alignment>
+size_t ArenaAllocator<T, Alignment>::GetStartingCapacity() const noexcept
 {
     return 1;
 }
 
-template <typename T>
-size_t ArenaAllocator<T>::GetNewCapacity(const size_t numOfElems) noexcept
+template <typename T, size_t Alignment>
+size_t ArenaAllocator<T, Alignment>::GetNewCapacity(const size_t numOfElems) noexcept
 {
     return Util::Math::NextPowerOfTwo(numOfElems + 1);
 }
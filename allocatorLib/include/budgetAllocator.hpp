@@ -0,0 +1,65 @@
+#pragma once
+
+#include <AllocatorLib/heapAllocator.hpp>
+#include <MemoryLib/memoryBudget.hpp>
+
+#include <cstddef>
+
+namespace Moon
+{
+// Charges every allocation of the wrapped allocator to a MemoryBudget and
+// throws std::bad_alloc once its hard limit is hit. The element count is kept
+// in a prefix in front of each allocation, so Deallocate can release the bytes.
+// Copies share the budget.
+template <typename T, typename Allocator = HeapAllocator<T>>
+class BudgetAllocator
+{
+   public:
+    using ValueType = T;
+    static constexpr size_t ALIGNMENT = Allocator::ALIGNMENT;
+
+    BudgetAllocator(MemoryBudget* budget, Allocator allocator = Allocator())
+        : mBudget(budget), mAllocator(std::move(allocator))
+    {
+    }
+
+    T* Allocate(size_t size);
+
+    void Deallocate(T*& ptr);
+
+    template <typename... Args>
+    void Construct(T* ptr, Args&&... args);
+
+    void Destruct(T* ptr) noexcept;
+
+    size_t GetNewCapacity(const size_t numOfElems) noexcept;
+
+    size_t GetStartingCapacity() const noexcept;
+
+    MemoryBudget* GetBudget() const noexcept
+    {
+        return mBudget;
+    }
+
+   private:
+    // Smallest number of elements that holds a size_t and keeps the
+    // allocation aligned to ALIGNMENT
+    static constexpr size_t CalcPrefixCount()
+    {
+        size_t count = 1;
+        while (count * sizeof(T) < sizeof(size_t) || count * sizeof(T) % ALIGNMENT != 0)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    static constexpr size_t PREFIX_COUNT = CalcPrefixCount();
+
+   private:
+    MemoryBudget* mBudget;
+    Allocator mAllocator;
+};
+}  // namespace Moon
+
+#include <AllocatorLib/budgetAllocator.ipp>
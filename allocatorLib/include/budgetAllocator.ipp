@@ -0,0 +1,74 @@
+#pragma once
+
+#include <AllocatorLib/budgetAllocator.hpp>
+
+#include <cstring>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename T, typename Allocator>
+T* BudgetAllocator<T, Allocator>::Allocate(size_t size)
+{
+    const size_t bytes = (size + PREFIX_COUNT) * sizeof(T);
+    mBudget->Charge(bytes);
+
+    T* base = nullptr;
+    try
+    {
+        base = mAllocator.Allocate(size + PREFIX_COUNT);
+    }
+    catch (...)
+    {
+        mBudget->Release(bytes);
+        throw;
+    }
+
+    T* ptr = base + PREFIX_COUNT;
+    // The prefix is not necessarily aligned for size_t
+    std::memcpy(reinterpret_cast<std::byte*>(ptr) - sizeof(size_t), &size, sizeof(size_t));
+    return ptr;
+}
+
+template <typename T, typename Allocator>
+void BudgetAllocator<T, Allocator>::Deallocate(T*& ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    size_t size;
+    std::memcpy(&size, reinterpret_cast<std::byte*>(ptr) - sizeof(size_t), sizeof(size_t));
+    T* base = ptr - PREFIX_COUNT;
+    mAllocator.Deallocate(base);
+    mBudget->Release((size + PREFIX_COUNT) * sizeof(T));
+    ptr = nullptr;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void BudgetAllocator<T, Allocator>::Construct(T* ptr, Args&&... args)
+{
+    mAllocator.Construct(ptr, std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator>
+void BudgetAllocator<T, Allocator>::Destruct(T* ptr) noexcept
+{
+    mAllocator.Destruct(ptr);
+}
+
+template <typename T, typename Allocator>
+size_t BudgetAllocator<T, Allocator>::GetNewCapacity(const size_t numOfElems) noexcept
+{
+    return mAllocator.GetNewCapacity(numOfElems);
+}
+
+template <typename T, typename Allocator>
+size_t BudgetAllocator<T, Allocator>::GetStartingCapacity() const noexcept
+{
+    return mAllocator.GetStartingCapacity();
+}
+}  // namespace Moon
@@ -6,10 +6,12 @@
 namespace Moon
 {
 
-template <typename T>
+template <typename T, size_t Alignment = alignof(T)>
 class DebugAllocator
 {
    public:
+    static constexpr size_t ALIGNMENT = Alignment;
+
     static T* Allocate(size_t size);
     static void Deallocate(T*& ptr);
 
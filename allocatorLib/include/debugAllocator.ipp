@@ -2,16 +2,17 @@
 
 #include <AllocatorLib/debugAllocator.hpp>
 #include <AllocatorLib/heapAllocator.hpp>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
 namespace Moon
 {
-template <typename T>
-std::unordered_map<T*, size_t> DebugAllocator<T>::mAllocations;
+template <typename T, size_t Alignment>
+std::unordered_map<T*, size_t> DebugAllocator<T, Alignment>::mAllocations;
 
-template <typename T>
-T* DebugAllocator<T>::Allocate(size_t size)
+template <typename T, size_t Alignment>
+T* DebugAllocator<T, Alignment>::Allocate(size_t size)
 {
     if (size == 0)
     {
@@ -19,7 +20,7 @@ T* DebugAllocator<T>::Allocate(size_t size)
             "DebugAllocator::Allocate(): size must be greater than 0");
     }
 
-    T* ptr = HeapAllocator<T>::Allocate(size);
+    T* ptr = HeapAllocator<T, Alignment>::Allocate(size);
     if (ptr == nullptr)
     {
         throw std::runtime_error(
@@ -31,8 +32,8 @@ T* DebugAllocator<T>::Allocate(size_t size)
     return ptr;
 }
 
-template <typename T>
-void DebugAllocator<T>::Deallocate(T*& ptr)
+template <typename T, size_t Alignment>
+void DebugAllocator<T, Alignment>::Deallocate(T*& ptr)
 {
     if (!ptr)
         return;
@@ -46,30 +47,30 @@ void DebugAllocator<T>::Deallocate(T*& ptr)
 
     mAllocations.erase(it);
 
-    HeapAllocator<T>::Deallocate(ptr);
+    HeapAllocator<T, Alignment>::Deallocate(ptr);
 }
 
-template <typename T>
+template <typename T, size_t Alignment>
 template <typename... Args>
-void DebugAllocator<T>::Construct(T* ptr, Args&&... args)
+void DebugAllocator<T, Alignment>::Construct(T* ptr, Args&&... args)
 {
-    HeapAllocator<T>::Construct(ptr, std::forward<Args>(args)...);
+    HeapAllocator<T, Alignment>::Construct(ptr, std::forward<Args>(args)...);
 }
 
-template <typename T>
-void DebugAllocator<T>::Destruct(T* ptr) noexcept
+template <typename T, size_t Alignment>
+void DebugAllocator<T, Alignment>::Destruct(T* ptr) noexcept
 {
-    HeapAllocator<T>::Destruct(ptr);
+    HeapAllocator<T, Alignment>::Destruct(ptr);
 }
 
-template <typename T>
-size_t DebugAllocator<T>::GetNewCapacity(const size_t numOfElems) noexcept
+template <typename T, size_t Alignment>
+size_t DebugAllocator<T, Alignment>::GetNewCapacity(const size_t numOfElems) noexcept
 {
-    return HeapAllocator<T>::GetNewCapacity(numOfElems);
+    return HeapAllocator<T, Alignment>::GetNewCapacity(numOfElems);
 }
 
-template <typename T>
-void DebugAllocator<T>::ReportLeaks()
+template <typename T, size_t Alignment>
+void DebugAllocator<T, Alignment>::ReportLeaks()
 {
     if (mAllocations.empty())
     {
@@ -5,11 +5,18 @@
 
 namespace Moon
 {
-// No bounds checking, this is to maximize performance
-template <typename T>
+// No bounds checking, this is to maximize performance.
+// Alignment can be raised above alignof(T), e.g. 64 for cache line or SIMD aligned data.
+template <typename T, size_t Alignment = alignof(T)>
 class HeapAllocator
 {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                  "HeapAllocator: Alignment must be a power of two and at least alignof(T)");
+
    public:
+    static constexpr size_t ALIGNMENT = Alignment;
+
+    // Throws std::bad_alloc when out of memory
     static T* Allocate(size_t size);
 
     static void Deallocate(T*& ptr);
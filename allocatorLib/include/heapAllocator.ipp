@@ -3,41 +3,60 @@
 #include <AllocatorLib/heapAllocator.hpp>
 #include <CommonLib/math.hpp>
 
+#include <cstddef>
+#include <cstdlib>
+#include <new>
 #include <utility>
 
 namespace Moon
 {
 
-template <typename T>
-T* HeapAllocator<T>::Allocate(size_t size)
+template <typename T, size_t Alignment>
+T* HeapAllocator<T, Alignment>::Allocate(size_t size)
 {
-    return static_cast<T*>(malloc(sizeof(T) * size));
+    T* ptr = nullptr;
+    if constexpr (Alignment <= alignof(std::max_align_t))
+    {
+        ptr = static_cast<T*>(malloc(sizeof(T) * size));
+    }
+    else
+    {
+        // aligned_alloc wants a size that is a multiple of the alignment
+        ptr = static_cast<T*>(
+            std::aligned_alloc(Alignment, Util::Math::AlignSize(sizeof(T) * size, Alignment)));
+    }
+    // malloc(0) may legitimately return nullptr
+    if (ptr == nullptr && size > 0)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
 }
 
-template <typename T>
-void HeapAllocator<T>::Deallocate(T*& ptr)
+template <typename T, size_t Alignment>
+void HeapAllocator<T, Alignment>::Deallocate(T*& ptr)
 {
     // no check for nullptr
     free(ptr);
     ptr = nullptr;
 }
 
-template <typename T>
+template <typename T, size_t Alignment>
 template <typename... Args>
-void HeapAllocator<T>::Construct(T* ptr, Args&&... args)
+void HeapAllocator<T, Alignment>::Construct(T* ptr, Args&&... args)
 {
     new (ptr) T(std::forward<Args>(args)...);
 }
 
-template <typename T>
-void HeapAllocator<T>::Destruct(T* ptr) noexcept
+template <typename T, size_t Alignment>
+void HeapAllocator<T, Alignment>::Destruct(T* ptr) noexcept
 {
     // no check for nullptr
     ptr->~T();
 }
 
-template <typename T>
-size_t HeapAllocator<T>::GetNewCapacity(const size_t numOfElems) noexcept
+template <typename T, size_t Alignment>
+size_t HeapAllocator<T, Alignment>::GetNewCapacity(const size_t numOfElems) noexcept
 {
     return Util::Math::NextPowerOfTwo(numOfElems + 1);
 }
@@ -9,13 +9,18 @@ namespace Moon
 // Note: The allocator does not own the memory segment, it is expected to be
 // created and managed externally. The allocator will allocate memory within
 // segment.
-template <typename T>
+// Named objects in the segment are only aligned to alignof(std::max_align_t),
+// so Alignment cannot be raised beyond it.
+template <typename T, size_t Alignment = alignof(T)>
 class ManagedSharedMemorySegmentAllocator
 {
     using ManagedSharedMemory = boost::interprocess::managed_shared_memory;
+    static_assert(Alignment >= alignof(T) && Alignment <= alignof(std::max_align_t),
+                  "ManagedSharedMemorySegmentAllocator: unsupported Alignment");
 
    public:
     static constexpr size_t STARTING_CAPACITY = 1;
+    static constexpr size_t ALIGNMENT = Alignment;
 
    public:
     ManagedSharedMemorySegmentAllocator(
@@ -6,16 +6,16 @@
 namespace Moon
 {
 
-template <typename T>
-T* ManagedSharedMemorySegmentAllocator<T>::Allocate(size_t size)
+template <typename T, size_t Alignment>
+T* ManagedSharedMemorySegmentAllocator<T, Alignment>::Allocate(size_t size)
 {
     void* ptr = mManagedSegment->find_or_construct<char>(
         mRegionName.c_str())[size * sizeof(T)]('\0');
     return static_cast<T*>(ptr);
 }
 
-template <typename T>
-void ManagedSharedMemorySegmentAllocator<T>::Deallocate(T*& ptr)
+template <typename T, size_t Alignment>
+void ManagedSharedMemorySegmentAllocator<T, Alignment>::Deallocate(T*& ptr)
 {
     // The pointer should be in the shared memory segment
     if (ptr)
@@ -25,9 +25,9 @@ void ManagedSharedMemorySegmentAllocator<T>::Deallocate(T*& ptr)
     }
 }
 
-template <typename T>
+template <typename T, size_t Alignment>
 template <typename... Args>
-void ManagedSharedMemorySegmentAllocator<T>::Construct(T* ptr, Args&&... args)
+void ManagedSharedMemorySegmentAllocator<T, Alignment>::Construct(T* ptr, Args&&... args)
 {
     if (ptr)
     {
@@ -35,8 +35,8 @@ void ManagedSharedMemorySegmentAllocator<T>::Construct(T* ptr, Args&&... args)
     }
 }
 
-template <typename T>
-void ManagedSharedMemorySegmentAllocator<T>::Destruct(T* ptr) noexcept
+template <typename T, size_t Alignment>
+void ManagedSharedMemorySegmentAllocator<T, Alignment>::Destruct(T* ptr) noexcept
 {
     if (ptr)
     {
@@ -44,8 +44,8 @@ void ManagedSharedMemorySegmentAllocator<T>::Destruct(T* ptr) noexcept
     }
 }
 
-template <typename T>
-size_t ManagedSharedMemorySegmentAllocator<T>::GetNewCapacity(
+template <typename T, size_t Alignment>
+size_t ManagedSharedMemorySegmentAllocator<T, Alignment>::GetNewCapacity(
     const size_t numOfElems) noexcept
 {
     return Util::Math::NextPowerOfTwo(numOfElems + 1);
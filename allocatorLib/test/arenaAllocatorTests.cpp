@@ -0,0 +1,123 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AllocatorLib/arenaAllocator.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Moon::Test
+{
+
+class ArenaAllocatorFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+
+    static bool IsChunkUsed(const ArenaChunk* chunk)
+    {
+        return static_cast<const ArenaChunkHeader*>(chunk)->mIsUsed;
+    }
+
+    template <typename T>
+    static ArenaChunk* GetChunk(T* ptr)
+    {
+        // Allocations are prefixed with their chunk
+        const auto prefixSize = std::max(sizeof(ArenaChunk*), alignof(T));
+        return *reinterpret_cast<ArenaChunk**>(reinterpret_cast<std::byte*>(ptr) - prefixSize);
+    }
+};
+
+TEST_F(ArenaAllocatorFixture, WHEN_several_allocations_are_live_THEN_each_is_released_individually)
+{
+    Arena arena(4096);
+    ArenaAllocator<int> allocator(&arena);
+
+    std::vector<int*> ptrs;
+    for (int i = 0; i < 10; ++i)
+    {
+        ptrs.push_back(allocator.Allocate(4));
+        ptrs.back()[0] = i;
+    }
+
+    auto* released = ptrs[3];
+    auto* releasedChunk = GetChunk(released);
+    allocator.Deallocate(released);
+
+    EXPECT_FALSE(IsChunkUsed(releasedChunk));
+    for (int i = 0; i < 10; ++i)
+    {
+        if (i != 3)
+        {
+            EXPECT_TRUE(IsChunkUsed(GetChunk(ptrs[i])));
+            EXPECT_EQ(ptrs[i][0], i);
+        }
+    }
+
+    // The released chunk is the best fit for the next allocation of that size
+    EXPECT_EQ(allocator.Allocate(4), ptrs[3]);
+}
+
+TEST_F(ArenaAllocatorFixture, WHEN_allocator_is_copied_or_rebound_THEN_both_release_into_same_arena)
+{
+    Arena arena(4096);
+    ArenaAllocator<int> allocator(&arena);
+    ArenaAllocator<int> copy(allocator);
+    ArenaAllocator<double> rebound(allocator);
+
+    EXPECT_EQ(rebound.GetArena(), &arena);
+
+    int* ptr = allocator.Allocate(8);
+    auto* chunk = GetChunk(ptr);
+    copy.Deallocate(ptr);
+    EXPECT_FALSE(IsChunkUsed(chunk));
+
+    double* doubles = rebound.Allocate(8);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(doubles) % alignof(double), 0);
+    rebound.Deallocate(doubles);
+}
+
+TEST_F(ArenaAllocatorFixture, WHEN_allocation_is_extended_THEN_prefix_follows_moved_header)
+{
+    Arena arena(4096);
+    ArenaAllocator<int> allocator(&arena);
+
+    int* ptr = allocator.Allocate(4);
+    auto* chunk = GetChunk(ptr);
+    ASSERT_TRUE(allocator.TryExtend(ptr, 256));
+
+    auto* extendedChunk = GetChunk(ptr);
+    EXPECT_NE(extendedChunk, chunk);
+    EXPECT_GE(extendedChunk->GetCapacity(), 256 * sizeof(int));
+
+    allocator.Deallocate(ptr);
+    EXPECT_FALSE(IsChunkUsed(extendedChunk));
+}
+
+TEST_F(ArenaAllocatorFixture, WHEN_type_or_allocator_is_over_aligned_THEN_allocations_are_aligned)
+{
+    struct alignas(128) CacheLinePair
+    {
+        int mValue;
+    };
+
+    Arena arena(4096);
+    ArenaAllocator<CacheLinePair> typeAligned(&arena);
+    ArenaAllocator<float, 256> explicitlyAligned(&arena);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        auto* pair = typeAligned.Allocate(3);
+        auto* floats = explicitlyAligned.Allocate(5);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(pair) % 128, 0);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(floats) % 256, 0);
+        pair[2].mValue = i;
+        floats[4] = 1.0f;
+    }
+}
+
+}  // namespace Moon::Test
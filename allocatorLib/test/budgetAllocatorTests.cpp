@@ -0,0 +1,82 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AllocatorLib/arenaAllocator.hpp>
+#include <AllocatorLib/budgetAllocator.hpp>
+#include <AllocatorLib/heapAllocator.hpp>
+
+#include <cstdint>
+#include <new>
+
+namespace Moon::Test
+{
+
+class BudgetAllocatorFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+};
+
+TEST_F(BudgetAllocatorFixture, WHEN_memory_is_allocated_and_freed_THEN_budget_is_charged_and_released)
+{
+    MemoryBudget budget(0);
+    BudgetAllocator<int> allocator(&budget);
+
+    int* ptr = allocator.Allocate(100);
+    for (int i = 0; i < 100; ++i)
+    {
+        ptr[i] = i;
+    }
+    EXPECT_GE(budget.GetUsed(), 100 * sizeof(int));
+
+    allocator.Deallocate(ptr);
+    EXPECT_EQ(ptr, nullptr);
+    EXPECT_EQ(budget.GetUsed(), 0);
+}
+
+TEST_F(BudgetAllocatorFixture, WHEN_hard_limit_is_hit_THEN_allocate_throws_and_charges_nothing)
+{
+    MemoryBudget budget(1024);
+    BudgetAllocator<char> allocator(&budget);
+
+    char* ptr = allocator.Allocate(512);
+    const auto used = budget.GetUsed();
+    EXPECT_THROW(allocator.Allocate(1024), std::bad_alloc);
+    EXPECT_EQ(budget.GetUsed(), used);
+    allocator.Deallocate(ptr);
+}
+
+TEST_F(BudgetAllocatorFixture, WHEN_allocators_are_copied_THEN_they_share_the_budget)
+{
+    MemoryBudget budget(0);
+    BudgetAllocator<double> allocator(&budget);
+    BudgetAllocator<double> copy = allocator;
+
+    double* ptr = allocator.Allocate(10);
+    EXPECT_GT(budget.GetUsed(), 0);
+    copy.Deallocate(ptr);
+    EXPECT_EQ(budget.GetUsed(), 0);
+}
+
+TEST_F(BudgetAllocatorFixture, WHEN_wrapped_allocator_is_over_aligned_THEN_alignment_is_kept)
+{
+    MemoryBudget budget(0);
+    BudgetAllocator<float, HeapAllocator<float, 64>> heapBacked(&budget);
+    Arena arena(4096);
+    BudgetAllocator<char, ArenaAllocator<char, 128>> arenaBacked(&budget, &arena);
+
+    float* floats = heapBacked.Allocate(7);
+    char* chars = arenaBacked.Allocate(3);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(floats) % 64, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(chars) % 128, 0);
+
+    heapBacked.Deallocate(floats);
+    arenaBacked.Deallocate(chars);
+    EXPECT_EQ(budget.GetUsed(), 0);
+}
+
+}  // namespace Moon::Test
@@ -2,48 +2,159 @@
 
 #include <AllocatorLib/heapAllocator.hpp>
 #include <CollisionHandlerLib/openAddressingCollisionHandlerIterator.hpp>
-#include <memory>  // todo: change
-#include <vector>  // todo: change
+#include <CollisionHandlerLib/probingPolicy.hpp>
+#include <CollisionHandlerLib/rehashPolicy.hpp>
+#include <CollisionHandlerLib/sizingPolicy.hpp>
+
+#include <cstddef>
+#include <cstdint>
 
 namespace Moon
 {
 
-template <typename Data,
-          typename Allocator = HeapAllocator<Data>>  // todo: allocator unused
+// Open addressing table with elements stored inline in one slot array and the
+// occupancy of each slot kept in a parallel state byte array. The probe
+// sequence comes from ProbingPolicy, the capacities and the mapping from
+// hash to home slot from SizingPolicy. Linear and quadratic probing turn
+// deleted slots into tombstones so probe sequences running through them stay
+// intact, Robin Hood probing never creates any.
+//
+// StopTheWorldRehash rehashes the whole table inside the insert that
+// triggers a resize. IncrementalRehash keeps the old table next to the new
+// one, every insert, delete and lookup migrates the next RehashPolicy::STEP
+// slots of it, and lookups search both tables until it is drained. This
+// bounds the latency of a single operation at the cost of holding both
+// tables during the migration.
+//
+// Data needs mKey and mValue members, DataHasher hashes a Data by its key
+// and is used to rehash, callers pass the hash of the key they look up.
+template <typename Data, typename DataHasher, typename Allocator = HeapAllocator<Data>,
+          typename ProbingPolicy = LinearProbing, typename SizingPolicy = PowerOfTwoSizing,
+          typename RehashPolicy = StopTheWorldRehash>
 class OpenAddressingCollisionHandler
 {
-   private:
-    struct Node
-    {
-        size_t mHash;
-        std::unique_ptr<Data> mData;
-    };
+    static_assert(SizingPolicy::POWER_OF_TWO || !ProbingPolicy::NEEDS_POWER_OF_TWO,
+                  "probing policy only covers power of two capacities");
 
    public:
     using IteratorType = OpenAddressingCollisionHandlerIterator<Data>;
+    using KeyType = decltype(Data::mKey);
+
+    static constexpr double DEFAULT_MAX_LOAD_FACTOR = 0.75;
 
-    OpenAddressingCollisionHandler();
-    OpenAddressingCollisionHandler(const size_t bucketSize);
+    explicit OpenAddressingCollisionHandler(const size_t bucketCount = 0,
+                                            const DataHasher& hasher = DataHasher(),
+                                            const Allocator& allocator = Allocator());
+    OpenAddressingCollisionHandler(const OpenAddressingCollisionHandler& other);
+    OpenAddressingCollisionHandler(OpenAddressingCollisionHandler&& other) noexcept;
+    OpenAddressingCollisionHandler& operator=(const OpenAddressingCollisionHandler& other);
+    OpenAddressingCollisionHandler& operator=(OpenAddressingCollisionHandler&& other) noexcept;
+    ~OpenAddressingCollisionHandler();
 
+    // Overwrites the value if the key is already present
     void Insert(const size_t hash, const Data& data);
-    void Delete(const size_t hash);
-    Data& LookupOrDefaultConstruct(const size_t hash);
-    IteratorType Find(const size_t hash);
+    // Lookups accept KeyType or any key type that compares equal to it with ==
+    template <typename LookupKey>
+    bool Delete(const size_t hash, const LookupKey& key);
+    Data& LookupOrDefaultConstruct(const size_t hash, const KeyType& key);
+    template <typename LookupKey>
+    IteratorType Find(const size_t hash, const LookupKey& key);
+    // Does not advance an incremental rehash, safe to call on a table other
+    // threads only read
+    template <typename LookupKey>
+    IteratorType Find(const size_t hash, const LookupKey& key) const;
+    void Clear();
+    // Starts loading the home slot of hash into the cache, lets batched
+    // lookups overlap their cache misses
+    void Prefetch(const size_t hash) const;
+
+    size_t Size() const noexcept;
+    size_t Capacity() const noexcept;
+    // Number of slots a lookup of key inspects, whether or not it is present
+    template <typename LookupKey>
+    size_t ProbeLength(const size_t hash, const LookupKey& key) const;
+    // True while an incremental rehash still has slots left to migrate
+    bool IsRehashing() const noexcept;
+    // True if inserting one more absent key would reallocate the slots
+    bool InsertWouldRehash() const noexcept;
+
+    // Share of the slots that full slots and tombstones may occupy before
+    // the table grows, in (0, 1). Grows the table if it is already above it.
+    void SetMaxLoadFactor(const double maxLoadFactor);
+    double GetMaxLoadFactor() const noexcept;
+
     IteratorType begin() const;
     IteratorType end() const;
     IteratorType Begin() const;
     IteratorType End() const;
 
    private:
-    void ResizeAndRehash(const size_t newSize);
+    static constexpr size_t NPOS = SIZE_MAX;
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    struct Table
+    {
+        uint8_t* mStates{nullptr};
+        Data* mSlots{nullptr};
+        size_t mCapacity{0};
+        SizingPolicy mSizing;
+    };
+
+    // Where a lookup found its key, mTable is null if it is absent
+    struct Location
+    {
+        const Table* mTable;
+        size_t mIndex;
+    };
+
+    size_t GetGrowthLimit(const size_t capacity) const;
+    size_t GetDistance(const Table& table, const size_t index) const;
+    static void SetDistance(Table& table, const size_t index, const size_t distance);
+
+    template <typename LookupKey>
+    size_t FindIndex(const Table& table, const size_t hash, const LookupKey& key,
+                     size_t* probeLength = nullptr) const;
+    template <typename LookupKey>
+    Location Locate(const size_t hash, const LookupKey& key) const;
+    // Claims a free slot for a key that is known to be absent, may grow the table
+    size_t PrepareInsert(const size_t hash);
+    // Claims a slot without growing, Robin Hood shifts the rest of the run
+    size_t ClaimSlot(Table& table, const size_t hash);
+    static size_t FindFirstFree(const Table& table, const size_t hash);
+    // Robin Hood deletion, pulls the displaced elements after index one
+    // slot closer to home and leaves the end of the run empty
+    void ShiftBackward(Table& table, size_t index);
+    void MoveElement(Table& from, const size_t index, Table& to);
+
+    void ResizeAndRehash(const size_t newCapacity);
+    void StartIncrementalRehash(const size_t newCapacity);
+    // Migration share of a single operation, a no-op for stop-the-world rehashing
+    void StepIncrementalRehash();
+    // Moves up to slotCount more slots of the old table, freeing it once drained
+    void MigrateSlots(const size_t slotCount);
+    void FinishIncrementalRehash();
+
+    void Allocate(const size_t capacity);
+    void DestroyElements(Table& table);
+    void FreeTable(Table& table);
+    void Destroy();
 
    private:
-    size_t mLoadFactor;
-    std::vector<Node> mHashTable;
+    using StateAllocator = HeapAllocator<uint8_t>;
+
+    Table mTable;
+    // The table being drained by an incremental rehash, empty otherwise
+    Table mOldTable;
+    size_t mOldElemCount{0};
+    size_t mMigrationCursor{0};
+    // Both tables together
     size_t mElemCount{0};
+    // Tombstones of mTable only
     size_t mTombstoneCount{0};
-    // note: tombstones are deleted elements that need to remain so
-    // that the probing sequence can continue correctly. mHash == mHashTable.size() -> tombstone
+    size_t mGrowthLimit{0};
+    double mMaxLoadFactor{DEFAULT_MAX_LOAD_FACTOR};
+    DataHasher mHasher;
+    Allocator mAllocator;
 };
 }  // namespace Moon
 
@@ -2,145 +2,732 @@
 
 #include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
 namespace Moon
 {
 
-template <typename Data, typename Allocator>
-void OpenAddressingCollisionHandler<Data, Allocator>::Insert(const size_t hash,
-                                                             const Data& data)
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::OpenAddressingCollisionHandler(
+    const size_t bucketCount, const DataHasher& hasher, const Allocator& allocator)
+    : mHasher(hasher), mAllocator(allocator)
 {
-    if (static_cast<double>(mElemCount) / mHashTable.size() > mLoadFactor)
+    if (bucketCount > 0)
     {
-        ResizeAndRehash(mHashTable.size() * 2);
+        Allocate(SizingPolicy::RoundUp(std::max(bucketCount, MIN_CAPACITY)));
     }
-    const size_t index = hash % mHashTable.size();
-    size_t currentIndex = index;
-    while (mHashTable[currentIndex].mData &&
-           mHashTable[currentIndex].mData->mKey != data.mKey)
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::OpenAddressingCollisionHandler(
+    const OpenAddressingCollisionHandler& other)
+    : mMaxLoadFactor(other.mMaxLoadFactor), mHasher(other.mHasher), mAllocator(other.mAllocator)
+{
+    if (other.mTable.mCapacity == 0)
     {
-        // todo: linear probing for now, make this configurable
-        currentIndex = (currentIndex + 1) % mHashTable.size();
+        return;
     }
 
-    if (mHashTable[currentIndex])
+    // Same capacity and hash function, so every element keeps its slot
+    Allocate(other.mTable.mCapacity);
+    for (size_t i = 0; i < mTable.mCapacity; ++i)
     {
-        mHashTable[currentIndex].mData->mValue = data.mValue;
+        if (OpenAddressingSlotState::IsFull(other.mTable.mStates[i]))
+        {
+            mAllocator.Construct(mTable.mSlots + i, other.mTable.mSlots[i]);
+        }
     }
-    else
+    std::memcpy(mTable.mStates, other.mTable.mStates, mTable.mCapacity);
+    mTombstoneCount = other.mTombstoneCount;
+
+    // The growth limit already accounts for the elements still waiting in
+    // the old table, so they fit without another resize
+    for (size_t i = 0; i < other.mOldTable.mCapacity; ++i)
+    {
+        if (OpenAddressingSlotState::IsFull(other.mOldTable.mStates[i]))
+        {
+            const size_t index = ClaimSlot(mTable, mHasher(other.mOldTable.mSlots[i]));
+            mAllocator.Construct(mTable.mSlots + index, other.mOldTable.mSlots[i]);
+        }
+    }
+    mElemCount = other.mElemCount;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::OpenAddressingCollisionHandler(
+    OpenAddressingCollisionHandler&& other) noexcept
+    : mTable(std::exchange(other.mTable, Table{})),
+      mOldTable(std::exchange(other.mOldTable, Table{})),
+      mOldElemCount(std::exchange(other.mOldElemCount, 0)),
+      mMigrationCursor(std::exchange(other.mMigrationCursor, 0)),
+      mElemCount(std::exchange(other.mElemCount, 0)),
+      mTombstoneCount(std::exchange(other.mTombstoneCount, 0)),
+      mGrowthLimit(std::exchange(other.mGrowthLimit, 0)),
+      mMaxLoadFactor(other.mMaxLoadFactor),
+      mHasher(std::move(other.mHasher)),
+      mAllocator(std::move(other.mAllocator))
+{
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>&
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::operator=(
+    const OpenAddressingCollisionHandler& other)
+{
+    if (this != &other)
+    {
+        OpenAddressingCollisionHandler copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>&
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::operator=(
+    OpenAddressingCollisionHandler&& other) noexcept
+{
+    if (this != &other)
+    {
+        Destroy();
+        mTable = std::exchange(other.mTable, Table{});
+        mOldTable = std::exchange(other.mOldTable, Table{});
+        mOldElemCount = std::exchange(other.mOldElemCount, 0);
+        mMigrationCursor = std::exchange(other.mMigrationCursor, 0);
+        mElemCount = std::exchange(other.mElemCount, 0);
+        mTombstoneCount = std::exchange(other.mTombstoneCount, 0);
+        mGrowthLimit = std::exchange(other.mGrowthLimit, 0);
+        mMaxLoadFactor = other.mMaxLoadFactor;
+        mHasher = std::move(other.mHasher);
+        mAllocator = std::move(other.mAllocator);
+    }
+    return *this;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::~OpenAddressingCollisionHandler()
+{
+    Destroy();
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Insert(
+    const size_t hash, const Data& data)
+{
+    StepIncrementalRehash();
+    const Location location = Locate(hash, data.mKey);
+    if (location.mTable != nullptr)
     {
-        mHashTable[currentIndex].mData = std::make_unique<Data>(data);
-        ++mElemCount;
+        location.mTable->mSlots[location.mIndex].mValue = data.mValue;
+        return;
     }
+    // PrepareInsert may reallocate the slots, so it must run first
+    const size_t index = PrepareInsert(hash);
+    mAllocator.Construct(mTable.mSlots + index, data);
 }
 
-template <typename Data, typename Allocator>
-void OpenAddressingCollisionHandler<Data, Allocator>::Delete(const size_t hash)
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+template <typename LookupKey>
+bool OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Delete(
+    const size_t hash, const LookupKey& key)
 {
-    size_t currentIndex = hash % mHashTable.size();
-    while (mHashTable[currentIndex]->mData &&
-           mHashTable[currentIndex]->mHash == hash)
+    StepIncrementalRehash();
+    const Location location = Locate(hash, key);
+    if (location.mTable == nullptr)
     {
-        currentIndex = (currentIndex + 1) % mHashTable.size();
+        return false;
     }
 
-    if (mHashTable[currentIndex].mData &&
-        mHashTable[currentIndex].mData->mHash == hash)
+    mAllocator.Destruct(location.mTable->mSlots + location.mIndex);
+    --mElemCount;
+    if (location.mTable == &mOldTable)
+    {
+        // The old table is only drained from now on, a tombstone is enough
+        mOldTable.mStates[location.mIndex] = OpenAddressingSlotState::DELETED;
+        --mOldElemCount;
+    }
+    else if constexpr (ProbingPolicy::ROBIN_HOOD)
     {
-        mHashTable[currentIndex].mData.reset(nullptr);
-        --mElemCount;
+        ShiftBackward(mTable, location.mIndex);
+    }
+    else
+    {
+        mTable.mStates[location.mIndex] = OpenAddressingSlotState::DELETED;
         ++mTombstoneCount;
     }
+    return true;
 }
 
-template <typename Data, typename Allocator>
-Data& OpenAddressingCollisionHandler<Data, Allocator>::LookupOrDefaultConstruct(
-    const size_t hash)
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+Data& OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::LookupOrDefaultConstruct(
+    const size_t hash, const KeyType& key)
 {
-    size_t currentIndex = hash % mHashTable.size();
-    while (mHashTable[currentIndex].mData &&
-           mHashTable[currentIndex].mData->mHash != hash)
+    StepIncrementalRehash();
+    const Location location = Locate(hash, key);
+    if (location.mTable != nullptr)
     {
-        currentIndex = (currentIndex + 1) % mHashTable.size();
+        return location.mTable->mSlots[location.mIndex];
     }
+    const size_t index = PrepareInsert(hash);
+    mAllocator.Construct(mTable.mSlots + index, Data{key, {}});
+    return mTable.mSlots[index];
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+template <typename LookupKey>
+typename OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::IteratorType
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Find(
+    const size_t hash, const LookupKey& key)
+{
+    StepIncrementalRehash();
+    return static_cast<const OpenAddressingCollisionHandler&>(*this).Find(hash, key);
+}
 
-    if (!mHashTable[currentIndex].mData)
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+template <typename LookupKey>
+typename OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::IteratorType
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Find(
+    const size_t hash, const LookupKey& key) const
+{
+    const Location location = Locate(hash, key);
+    if (location.mTable == nullptr)
     {
-        mHashTable[currentIndex].mData =
-            std::make_unique<Data>(Data{hash, Data::DefaultValue()});
-        ++mElemCount;
+        return end();
     }
+    if (location.mTable == &mOldTable)
+    {
+        // Iteration continues from the old table into the new one
+        return IteratorType(mOldTable.mStates + location.mIndex, mOldTable.mSlots + location.mIndex,
+                            mTable.mStates, mTable.mSlots);
+    }
+    return IteratorType(mTable.mStates + location.mIndex, mTable.mSlots + location.mIndex);
+}
 
-    return *mHashTable[currentIndex].mData;
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Clear()
+{
+    DestroyElements(mTable);
+    if (mTable.mCapacity > 0)
+    {
+        std::fill(mTable.mStates, mTable.mStates + mTable.mCapacity,
+                  OpenAddressingSlotState::EMPTY);
+    }
+    DestroyElements(mOldTable);
+    FreeTable(mOldTable);
+    mOldElemCount = 0;
+    mMigrationCursor = 0;
+    mElemCount = 0;
+    mTombstoneCount = 0;
 }
 
-template <typename Data, typename Allocator>
-typename OpenAddressingCollisionHandler<Data, Allocator>::IteratorType
-OpenAddressingCollisionHandler<Data, Allocator>::Find(const size_t hash)
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Prefetch(
+    const size_t hash) const
 {
-    size_t currentIndex = hash % mHashTable.size();
-    while (mHashTable[currentIndex].mData &&
-           mHashTable[currentIndex].mData->mHash != hash)
+    if (mTable.mCapacity == 0)
     {
-        currentIndex = (currentIndex + 1) % mHashTable.size();
+        return;
     }
+    const size_t home = mTable.mSizing.Home(hash);
+    __builtin_prefetch(mTable.mStates + home);
+    __builtin_prefetch(mTable.mSlots + home);
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Size() const noexcept
+{
+    return mElemCount;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Capacity() const noexcept
+{
+    return mTable.mCapacity;
+}
 
-    if (mHashTable[currentIndex].mData &&
-        mHashTable[currentIndex].mData->mHash == hash)
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+template <typename LookupKey>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::ProbeLength(
+    const size_t hash, const LookupKey& key) const
+{
+    size_t probeLength = 0;
+    if (FindIndex(mTable, hash, key, &probeLength) == NPOS && IsRehashing())
     {
-        return IteratorType(&mHashTable[currentIndex].mData);
+        size_t oldProbeLength = 0;
+        FindIndex(mOldTable, hash, key, &oldProbeLength);
+        probeLength += oldProbeLength;
     }
-    return IteratorType(nullptr); 
+    return probeLength;
 }
 
-template <typename Data, typename Allocator>
-void OpenAddressingCollisionHandler<Data, Allocator>::ResizeAndRehash(
-    const size_t newSize)
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+bool OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::IsRehashing() const noexcept
 {
-    std::vector<Node> newHashTable(newSize);
-    for (const auto& node : mHashTable)
+    return mOldTable.mCapacity != 0;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+bool OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::InsertWouldRehash() const noexcept
+{
+    return mTable.mCapacity == 0 || mElemCount + mTombstoneCount + 1 > mGrowthLimit;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::SetMaxLoadFactor(
+    const double maxLoadFactor)
+{
+    if (!(maxLoadFactor > 0 && maxLoadFactor < 1))
+    {
+        throw std::out_of_range("SetMaxLoadFactor(): load factor must be in (0, 1)");
+    }
+    mMaxLoadFactor = maxLoadFactor;
+    if (mTable.mCapacity == 0)
     {
-        if (node.mData)
+        return;
+    }
+
+    FinishIncrementalRehash();
+    mGrowthLimit = GetGrowthLimit(mTable.mCapacity);
+    if (mElemCount + mTombstoneCount > mGrowthLimit)
+    {
+        size_t newCapacity = mTable.mCapacity;
+        while (mElemCount > GetGrowthLimit(newCapacity))
         {
-            size_t currentIndex = node.mHash % newSize;
-            while (newHashTable[currentIndex].mData)
+            newCapacity = SizingPolicy::Grow(newCapacity);
+        }
+        ResizeAndRehash(newCapacity);
+    }
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+double OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::GetMaxLoadFactor() const noexcept
+{
+    return mMaxLoadFactor;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+typename OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::IteratorType
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::begin() const
+{
+    if (mTable.mCapacity == 0)
+    {
+        return end();
+    }
+    IteratorType it = IsRehashing() ? IteratorType(mOldTable.mStates, mOldTable.mSlots,
+                                                   mTable.mStates, mTable.mSlots)
+                                    : IteratorType(mTable.mStates, mTable.mSlots);
+    it.SkipFreeSlots();
+    return it;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+typename OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::IteratorType
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::end() const
+{
+    return IteratorType(mTable.mStates + mTable.mCapacity, mTable.mSlots + mTable.mCapacity);
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+typename OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::IteratorType
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Begin() const
+{
+    return begin();
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+typename OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::IteratorType
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::End() const
+{
+    return end();
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::GetGrowthLimit(
+    const size_t capacity) const
+{
+    // At least one slot stays empty, it ends every probe sequence
+    return std::min(capacity - 1, static_cast<size_t>(capacity * mMaxLoadFactor));
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::GetDistance(
+    const Table& table, const size_t index) const
+{
+    const size_t stored = table.mStates[index] - OpenAddressingSlotState::FULL;
+    if (stored < OpenAddressingSlotState::MAX_DISTANCE)
+    {
+        return stored;
+    }
+    // Saturated, only long runs under a poor hash get here
+    const size_t home = table.mSizing.Home(mHasher(table.mSlots[index]));
+    return index >= home ? index - home : index + table.mCapacity - home;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::SetDistance(
+    Table& table, const size_t index, const size_t distance)
+{
+    const size_t stored = std::min<size_t>(distance, OpenAddressingSlotState::MAX_DISTANCE);
+    table.mStates[index] = static_cast<uint8_t>(OpenAddressingSlotState::FULL + stored);
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+template <typename LookupKey>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::FindIndex(
+    const Table& table, const size_t hash, const LookupKey& key, size_t* probeLength) const
+{
+    if (table.mCapacity == 0)
+    {
+        if (probeLength != nullptr)
+        {
+            *probeLength = 0;
+        }
+        return NPOS;
+    }
+
+    // The growth limit guarantees an empty slot, which ends every probe
+    size_t result = NPOS;
+    size_t index = table.mSizing.Home(hash);
+    size_t step = 1;
+    for (;; ++step)
+    {
+        const uint8_t state = table.mStates[index];
+        if (state == OpenAddressingSlotState::EMPTY)
+        {
+            break;
+        }
+        if (OpenAddressingSlotState::IsFull(state))
+        {
+            if constexpr (ProbingPolicy::ROBIN_HOOD)
+            {
+                // The key would have displaced this element had it been
+                // inserted. Only a table being drained holds tombstones,
+                // they are skipped.
+                if (GetDistance(table, index) < step - 1)
+                {
+                    break;
+                }
+            }
+            if (table.mSlots[index].mKey == key)
+            {
+                result = index;
+                break;
+            }
+        }
+        index = table.mSizing.Wrap(ProbingPolicy::Next(index, step));
+    }
+
+    if (probeLength != nullptr)
+    {
+        *probeLength = step;
+    }
+    return result;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+template <typename LookupKey>
+typename OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Location
+OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Locate(
+    const size_t hash, const LookupKey& key) const
+{
+    size_t index = FindIndex(mTable, hash, key);
+    if (index != NPOS)
+    {
+        return Location{&mTable, index};
+    }
+    if constexpr (RehashPolicy::STEP > 0)
+    {
+        if (IsRehashing())
+        {
+            index = FindIndex(mOldTable, hash, key);
+            if (index != NPOS)
             {
-                currentIndex = (currentIndex + 1) % newSize;
+                return Location{&mOldTable, index};
             }
-            newHashTable[currentIndex] = node;
         }
     }
-    mHashTable = std::move(newHashTable);
+    return Location{nullptr, NPOS};
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::FindFirstFree(
+    const Table& table, const size_t hash)
+{
+    size_t index = table.mSizing.Home(hash);
+    for (size_t step = 1; OpenAddressingSlotState::IsFull(table.mStates[index]); ++step)
+    {
+        index = table.mSizing.Wrap(ProbingPolicy::Next(index, step));
+    }
+    return index;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::PrepareInsert(
+    const size_t hash)
+{
+    if (mTable.mCapacity == 0)
+    {
+        Allocate(SizingPolicy::RoundUp(MIN_CAPACITY));
+    }
+    else if (mElemCount + mTombstoneCount + 1 > mGrowthLimit)
+    {
+        // Only grow if live elements need the room, otherwise dropping the
+        // tombstones at the current capacity is enough
+        const bool grow = (mElemCount + 1) * 2 > mGrowthLimit;
+        const size_t newCapacity = grow ? SizingPolicy::Grow(mTable.mCapacity) : mTable.mCapacity;
+        if constexpr (RehashPolicy::STEP > 0)
+        {
+            // The step is too small to keep up with the inserts, the previous
+            // rehash has to finish before the next can start
+            FinishIncrementalRehash();
+            StartIncrementalRehash(newCapacity);
+        }
+        else
+        {
+            ResizeAndRehash(newCapacity);
+        }
+    }
+
+    const size_t index = ClaimSlot(mTable, hash);
+    ++mElemCount;
+    return index;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+size_t OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::ClaimSlot(
+    Table& table, const size_t hash)
+{
+    if constexpr (!ProbingPolicy::ROBIN_HOOD)
+    {
+        const size_t index = FindFirstFree(table, hash);
+        if (table.mStates[index] == OpenAddressingSlotState::DELETED)
+        {
+            --mTombstoneCount;
+        }
+        table.mStates[index] = OpenAddressingSlotState::FULL;
+        return index;
+    }
+    else
+    {
+        // The new element belongs before the first element that is closer
+        // to its home than the new one would be
+        size_t index = table.mSizing.Home(hash);
+        size_t distance = 0;
+        while (OpenAddressingSlotState::IsFull(table.mStates[index]) &&
+               GetDistance(table, index) >= distance)
+        {
+            index = table.mSizing.Wrap(ProbingPolicy::Next(index, 0));
+            ++distance;
+        }
+
+        // Shift the rest of the run one slot towards its end
+        size_t last = index;
+        while (table.mStates[last] != OpenAddressingSlotState::EMPTY)
+        {
+            last = table.mSizing.Wrap(ProbingPolicy::Next(last, 0));
+        }
+        while (last != index)
+        {
+            const size_t previous = (last == 0 ? table.mCapacity : last) - 1;
+            SetDistance(table, last, GetDistance(table, previous) + 1);
+            mAllocator.Construct(table.mSlots + last, std::move(table.mSlots[previous]));
+            mAllocator.Destruct(table.mSlots + previous);
+            last = previous;
+        }
+
+        SetDistance(table, index, distance);
+        return index;
+    }
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::ShiftBackward(
+    Table& table, size_t index)
+{
+    size_t next = table.mSizing.Wrap(ProbingPolicy::Next(index, 0));
+    while (OpenAddressingSlotState::IsFull(table.mStates[next]) && GetDistance(table, next) > 0)
+    {
+        SetDistance(table, index, GetDistance(table, next) - 1);
+        mAllocator.Construct(table.mSlots + index, std::move(table.mSlots[next]));
+        mAllocator.Destruct(table.mSlots + next);
+        index = next;
+        next = table.mSizing.Wrap(ProbingPolicy::Next(next, 0));
+    }
+    table.mStates[index] = OpenAddressingSlotState::EMPTY;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::MoveElement(
+    Table& from, const size_t index, Table& to)
+{
+    const size_t toIndex = ClaimSlot(to, mHasher(from.mSlots[index]));
+    mAllocator.Construct(to.mSlots + toIndex, std::move(from.mSlots[index]));
+    mAllocator.Destruct(from.mSlots + index);
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::ResizeAndRehash(
+    const size_t newCapacity)
+{
+    // Elements are moved straight from the old slot array into the new one,
+    // no per element allocation is involved
+    Table oldTable = mTable;
+    Allocate(newCapacity);
     mTombstoneCount = 0;
+    for (size_t i = 0; i < oldTable.mCapacity; ++i)
+    {
+        if (OpenAddressingSlotState::IsFull(oldTable.mStates[i]))
+        {
+            MoveElement(oldTable, i, mTable);
+        }
+    }
+    FreeTable(oldTable);
 }
 
-template <typename Data, typename Allocator>
-typename OpenAddressingCollisionHandler<Data, Allocator>::IteratorType OpenAddressingCollisionHandler<Data, Allocator>::begin() const
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::StartIncrementalRehash(
+    const size_t newCapacity)
 {
-    for (size_t i = 0; i < mHashTable.size(); ++i)
+    mOldTable = mTable;
+    mOldElemCount = mElemCount;
+    mMigrationCursor = 0;
+    Allocate(newCapacity);
+    mTombstoneCount = 0;
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::StepIncrementalRehash()
+{
+    if constexpr (RehashPolicy::STEP > 0)
     {
-        if (mHashTable[i].mData)
+        MigrateSlots(RehashPolicy::STEP);
+    }
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::MigrateSlots(
+    const size_t slotCount)
+{
+    if (!IsRehashing())
+    {
+        return;
+    }
+
+    const size_t end = std::min(mOldTable.mCapacity, mMigrationCursor + slotCount);
+    for (; mMigrationCursor < end && mOldElemCount > 0; ++mMigrationCursor)
+    {
+        if (OpenAddressingSlotState::IsFull(mOldTable.mStates[mMigrationCursor]))
         {
-            return IteratorType(&mHashTable[i].mData);
+            MoveElement(mOldTable, mMigrationCursor, mTable);
+            // Probe sequences of the elements still waiting run through here
+            mOldTable.mStates[mMigrationCursor] = OpenAddressingSlotState::DELETED;
+            --mOldElemCount;
         }
     }
+
+    if (mOldElemCount == 0)
+    {
+        FreeTable(mOldTable);
+        mMigrationCursor = 0;
+    }
 }
 
-template <typename Data, typename Allocator>
-typename OpenAddressingCollisionHandler<Data, Allocator>::IteratorType OpenAddressingCollisionHandler<Data, Allocator>::Begin() const
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::FinishIncrementalRehash()
 {
-    return begin();
+    MigrateSlots(mOldTable.mCapacity);
 }
 
-template <typename Data, typename Allocator>
-typename OpenAddressingCollisionHandler<Data, Allocator>::IteratorType OpenAddressingCollisionHandler<Data, Allocator>::end() const
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Allocate(
+    const size_t capacity)
 {
-    return IteratorType(nullptr); 
+    mTable.mStates = StateAllocator::Allocate(capacity + 1);
+    std::fill(mTable.mStates, mTable.mStates + capacity, OpenAddressingSlotState::EMPTY);
+    mTable.mStates[capacity] = OpenAddressingSlotState::SENTINEL;
+    mTable.mSlots = mAllocator.Allocate(capacity);
+    mTable.mCapacity = capacity;
+    mTable.mSizing.Resize(capacity);
+    mGrowthLimit = GetGrowthLimit(capacity);
 }
 
-template <typename Data, typename Allocator>
-typename OpenAddressingCollisionHandler<Data, Allocator>::IteratorType OpenAddressingCollisionHandler<Data, Allocator>::End() const
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::DestroyElements(
+    Table& table)
 {
-    return end();
+    for (size_t i = 0; i < table.mCapacity; ++i)
+    {
+        if (OpenAddressingSlotState::IsFull(table.mStates[i]))
+        {
+            mAllocator.Destruct(table.mSlots + i);
+        }
+    }
+}
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::FreeTable(
+    Table& table)
+{
+    if (table.mCapacity == 0)
+    {
+        return;
+    }
+    mAllocator.Deallocate(table.mSlots);
+    StateAllocator::Deallocate(table.mStates);
+    table = Table{};
 }
 
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+void OpenAddressingCollisionHandler<Data, DataHasher, Allocator, ProbingPolicy, SizingPolicy, RehashPolicy>::Destroy()
+{
+    Clear();
+    FreeTable(mTable);
+    mGrowthLimit = 0;
+}
 }  // namespace Moon
@@ -1,43 +1,76 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+
 namespace Moon
 {
 
+// State byte of an open addressing slot. Every free state compares below
+// FULL, and the state array has one SENTINEL entry after the last slot,
+// which stops iteration.
+struct OpenAddressingSlotState
+{
+    static constexpr uint8_t EMPTY = 0;
+    static constexpr uint8_t DELETED = 1;
+    // Full slots hold FULL plus their Robin Hood distance from home,
+    // saturated at MAX_DISTANCE. Other policies store FULL only.
+    static constexpr uint8_t FULL = 2;
+    static constexpr uint8_t MAX_DISTANCE = 252;
+    static constexpr uint8_t SENTINEL = 0xFF;
+
+    static bool IsFull(const uint8_t state)
+    {
+        return state >= FULL && state != SENTINEL;
+    }
+};
+
+template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+          typename SizingPolicy, typename RehashPolicy>
+class OpenAddressingCollisionHandler;
+
+// Walks the full slots in table order. During an incremental rehash it walks
+// the table being drained first and continues with the new one at its sentinel.
 template <typename T>
 class OpenAddressingCollisionHandlerIterator
 {
    public:
+    // A singular iterator, only good for assigning to
+    OpenAddressingCollisionHandlerIterator() noexcept = default;
+
     OpenAddressingCollisionHandlerIterator& operator++() noexcept;
     OpenAddressingCollisionHandlerIterator operator++(int) noexcept;
-    OpenAddressingCollisionHandlerIterator& operator--() noexcept;
-    OpenAddressingCollisionHandlerIterator operator--(int) noexcept;
-    OpenAddressingCollisionHandlerIterator operator+(int offset) const noexcept;
-    OpenAddressingCollisionHandlerIterator operator-(int offset) const noexcept;
-    size_t operator-(
-        const OpenAddressingCollisionHandlerIterator& other) const noexcept;
-
-    bool operator==(
-        const OpenAddressingCollisionHandlerIterator& other) const noexcept;
-    bool operator!=(
-        const OpenAddressingCollisionHandlerIterator& other) const noexcept;
-    bool operator>(
-        const OpenAddressingCollisionHandlerIterator& other) const noexcept;
-    bool operator<(
-        const OpenAddressingCollisionHandlerIterator& other) const noexcept;
-    bool operator>=(
-        const OpenAddressingCollisionHandlerIterator& other) const noexcept;
-    bool operator<=(
-        const OpenAddressingCollisionHandlerIterator& other) const noexcept;
-
-    T& operator*();
-    T* operator->() noexcept;
+
+    bool operator==(const OpenAddressingCollisionHandlerIterator& other) const noexcept;
+    bool operator!=(const OpenAddressingCollisionHandlerIterator& other) const noexcept;
+
+    T& operator*() const noexcept;
+    T* operator->() const noexcept;
 
    private:
-    OpenAddressingCollisionHandlerIterator();
+    OpenAddressingCollisionHandlerIterator(const uint8_t* state, T* slot) noexcept
+        : mState(state), mSlot(slot)
+    {
+    }
+    OpenAddressingCollisionHandlerIterator(const uint8_t* state, T* slot, const uint8_t* nextState,
+                                           T* nextSlot) noexcept
+        : mState(state), mSlot(slot), mNextState(nextState), mNextSlot(nextSlot)
+    {
+    }
+    void SkipFreeSlots() noexcept;
 
    private:
-    T* mPtr;
+    const uint8_t* mState{nullptr};
+    T* mSlot{nullptr};
+    // Table to continue with at the sentinel, null in the last one
+    const uint8_t* mNextState{nullptr};
+    T* mNextSlot{nullptr};
+
+    template <typename Data, typename DataHasher, typename Allocator, typename ProbingPolicy,
+              typename SizingPolicy, typename RehashPolicy>
+    friend class OpenAddressingCollisionHandler;
 };
 
 }  // namespace Moon
+
+#include <CollisionHandlerLib/openAddressingCollisionHandlerIterator.ipp>
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <CollisionHandlerLib/openAddressingCollisionHandlerIterator.hpp>
+
+namespace Moon
+{
+
+template <typename T>
+OpenAddressingCollisionHandlerIterator<T>& OpenAddressingCollisionHandlerIterator<T>::operator++() noexcept
+{
+    ++mState;
+    ++mSlot;
+    SkipFreeSlots();
+    return *this;
+}
+
+template <typename T>
+OpenAddressingCollisionHandlerIterator<T> OpenAddressingCollisionHandlerIterator<T>::operator++(int) noexcept
+{
+    OpenAddressingCollisionHandlerIterator<T> temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+bool OpenAddressingCollisionHandlerIterator<T>::operator==(
+    const OpenAddressingCollisionHandlerIterator& other) const noexcept
+{
+    return mSlot == other.mSlot;
+}
+
+template <typename T>
+bool OpenAddressingCollisionHandlerIterator<T>::operator!=(
+    const OpenAddressingCollisionHandlerIterator& other) const noexcept
+{
+    return mSlot != other.mSlot;
+}
+
+template <typename T>
+T& OpenAddressingCollisionHandlerIterator<T>::operator*() const noexcept
+{
+    return *mSlot;
+}
+
+template <typename T>
+T* OpenAddressingCollisionHandlerIterator<T>::operator->() const noexcept
+{
+    return mSlot;
+}
+
+template <typename T>
+void OpenAddressingCollisionHandlerIterator<T>::SkipFreeSlots() noexcept
+{
+    for (;;)
+    {
+        while (*mState < OpenAddressingSlotState::FULL)
+        {
+            ++mState;
+            ++mSlot;
+        }
+        if (*mState != OpenAddressingSlotState::SENTINEL || mNextState == nullptr)
+        {
+            return;
+        }
+        mState = mNextState;
+        mSlot = mNextSlot;
+        mNextState = nullptr;
+        mNextSlot = nullptr;
+    }
+}
+}  // namespace Moon
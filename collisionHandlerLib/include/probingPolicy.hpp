@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Moon
+{
+
+// Probing policies of OpenAddressingCollisionHandler. Next returns the slot
+// inspected after `index` on the `step`-th probe (step starts at 1), before
+// the sizing policy wraps it into the table. Every sequence visits all slots
+// of a power of two capacity.
+
+// Scans consecutive slots, the most cache friendly but clusters badly at
+// high load
+struct LinearProbing
+{
+    static constexpr bool ROBIN_HOOD = false;
+    static constexpr bool NEEDS_POWER_OF_TWO = false;
+
+    static size_t Next(const size_t index, const size_t)
+    {
+        return index + 1;
+    }
+};
+
+// Triangular offsets (1, 3, 6, ...) break up the primary clusters of linear
+// probing at the cost of locality. They only cover every slot of a power of
+// two capacity.
+struct QuadraticProbing
+{
+    static constexpr bool ROBIN_HOOD = false;
+    static constexpr bool NEEDS_POWER_OF_TWO = true;
+
+    static size_t Next(const size_t index, const size_t step)
+    {
+        return index + step;
+    }
+};
+
+// Linear probing that keeps every run sorted by distance from home: an
+// insert takes the slot of the first element closer to its home and shifts
+// the rest of the run back. Lookups stop as soon as they pass an element
+// closer to home than the key would be, and deletions shift the run forward
+// again instead of leaving tombstones.
+struct RobinHoodProbing
+{
+    static constexpr bool ROBIN_HOOD = true;
+    static constexpr bool NEEDS_POWER_OF_TWO = false;
+
+    static size_t Next(const size_t index, const size_t)
+    {
+        return index + 1;
+    }
+};
+}  // namespace Moon
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Moon
+{
+
+// Rehash policies of OpenAddressingCollisionHandler. STEP is the number of
+// old table slots every insert, delete and lookup migrates while a resize is
+// in progress, 0 rehashes the whole table inside the insert that triggers it.
+
+struct StopTheWorldRehash
+{
+    static constexpr size_t STEP = 0;
+};
+
+// Keeps the old table next to the new one until later operations drain it,
+// bounding the latency of a single operation
+template <size_t Step>
+struct IncrementalRehash
+{
+    static_assert(Step > 0, "an incremental rehash has to migrate at least one slot per operation");
+    static constexpr size_t STEP = Step;
+};
+}  // namespace Moon
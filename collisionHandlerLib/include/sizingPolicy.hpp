@@ -0,0 +1,114 @@
+#pragma once
+
+#include <CommonLib/math.hpp>
+#include <HashLib/hashing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace Moon
+{
+
+// Sizing policies of OpenAddressingCollisionHandler. They pick the table
+// capacities, map a caller hash to its home slot and wrap probe indices, all
+// without a division per probe. Resize must be called whenever the
+// capacity changes.
+
+// Power of two capacities. The home slot is taken from the high bits of a
+// fibonacci multiply, which spreads identity hashes such as std::hash<int>
+// evenly, and probe indices wrap with a mask.
+class PowerOfTwoSizing
+{
+   public:
+    static constexpr bool POWER_OF_TWO = true;
+
+    static size_t RoundUp(const size_t minCapacity)
+    {
+        return Util::Math::NextPowerOfTwo(minCapacity);
+    }
+
+    static size_t Grow(const size_t capacity)
+    {
+        return capacity * 2;
+    }
+
+    void Resize(const size_t capacity)
+    {
+        mMask = capacity - 1;
+        mShift = 64 - static_cast<uint32_t>(__builtin_ctzll(capacity));
+    }
+
+    size_t Home(const size_t hash) const
+    {
+        return static_cast<size_t>(Util::Hashing::FibonacciMultiply(hash) >> mShift);
+    }
+
+    size_t Wrap(const size_t index) const
+    {
+        return index & mMask;
+    }
+
+   private:
+    size_t mMask{0};
+    uint32_t mShift{64};
+};
+
+// Prime capacities of roughly twice the previous one, for hashes whose low
+// bits are too regular even for a multiplicative mix. The home slot is the
+// hash folded to 32 bits modulo the capacity, computed with Lemire's fastmod
+// (two multiplies against a precomputed reciprocal) instead of a division.
+// Probe sequences may only step less than one capacity at a time.
+class PrimeSizing
+{
+   public:
+    static constexpr bool POWER_OF_TWO = false;
+
+    static size_t RoundUp(const size_t minCapacity)
+    {
+        const auto it = std::lower_bound(PRIMES.begin(), PRIMES.end(), minCapacity);
+        if (it == PRIMES.end())
+        {
+            throw std::length_error("RoundUp(): capacity too large for prime sizing");
+        }
+        return *it;
+    }
+
+    static size_t Grow(const size_t capacity)
+    {
+        return RoundUp(capacity + 1);
+    }
+
+    void Resize(const size_t capacity)
+    {
+        mCapacity = capacity;
+        mReciprocal = UINT64_MAX / capacity + 1;
+    }
+
+    size_t Home(const size_t hash) const
+    {
+        const auto folded = static_cast<uint32_t>(hash ^ (static_cast<uint64_t>(hash) >> 32));
+        const uint64_t lowBits = mReciprocal * folded;
+        return static_cast<size_t>((static_cast<__uint128_t>(lowBits) * mCapacity) >> 64);
+    }
+
+    size_t Wrap(const size_t index) const
+    {
+        return index >= mCapacity ? index - mCapacity : index;
+    }
+
+   private:
+    // Smallest prime above each power of two from 16. The last one is the
+    // largest prime below 2^32, fastmod divisors must fit in 32 bits.
+    static constexpr std::array<size_t, 29> PRIMES = {
+        17,        37,        67,        131,        257,        521,        1031,     2053,
+        4099,      8209,      16411,     32771,      65537,      131101,     262147,   524309,
+        1048583,   2097169,   4194319,   8388617,    16777259,   33554467,   67108879, 134217757,
+        268435459, 536870923, 1073741827, 2147483659, 4294967291};
+
+    size_t mCapacity{1};
+    uint64_t mReciprocal{0};
+};
+}  // namespace Moon
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <AllocatorLib/heapAllocator.hpp>
+#include <CollisionHandlerLib/swissTableCollisionHandlerIterator.hpp>
+#include <CollisionHandlerLib/swissTableGroup.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Moon
+{
+
+// Flat open addressing table in the style of Abseil's SwissTable. A separate
+// control byte array holds a 7-bit tag per slot, and each probe step matches
+// a whole group of 16 tags with one SSE2 compare, so most lookups touch one
+// control group and one slot. Elements live inline in the slot array.
+//
+// Data needs mKey and mValue members, DataHasher hashes a Data by its key
+// and is only used to rehash, callers pass the hash of the key they look up.
+template <typename Data, typename DataHasher, typename Allocator = HeapAllocator<Data>>
+class SwissTableCollisionHandler
+{
+   public:
+    using IteratorType = SwissTableCollisionHandlerIterator<Data>;
+    using KeyType = decltype(Data::mKey);
+
+    explicit SwissTableCollisionHandler(const size_t bucketCount = 0,
+                                        const DataHasher& hasher = DataHasher(),
+                                        const Allocator& allocator = Allocator());
+    SwissTableCollisionHandler(const SwissTableCollisionHandler& other);
+    SwissTableCollisionHandler(SwissTableCollisionHandler&& other) noexcept;
+    SwissTableCollisionHandler& operator=(const SwissTableCollisionHandler& other);
+    SwissTableCollisionHandler& operator=(SwissTableCollisionHandler&& other) noexcept;
+    ~SwissTableCollisionHandler();
+
+    // Overwrites the value if the key is already present
+    void Insert(const size_t hash, const Data& data);
+    // Lookups accept KeyType or any key type that compares equal to it with ==
+    template <typename LookupKey>
+    bool Delete(const size_t hash, const LookupKey& key);
+    Data& LookupOrDefaultConstruct(const size_t hash, const KeyType& key);
+    template <typename LookupKey>
+    IteratorType Find(const size_t hash, const LookupKey& key);
+    void Clear();
+    // Starts loading the home slot of hash into the cache, lets batched
+    // lookups overlap their cache misses
+    void Prefetch(const size_t hash) const;
+
+    size_t Size() const noexcept;
+    size_t Capacity() const noexcept;
+
+    IteratorType begin() const;
+    IteratorType end() const;
+    IteratorType Begin() const;
+    IteratorType End() const;
+
+   private:
+    static constexpr size_t NPOS = SIZE_MAX;
+    static constexpr size_t MIN_CAPACITY = SwissTableGroup::WIDTH;
+
+    // Scrambles the caller's hash so that identity hashes (std::hash<int>)
+    // still spread over both the group index and the tag
+    static size_t Mix(const size_t hash);
+    static size_t GroupIndex(const size_t mixedHash);
+    static int8_t Tag(const size_t mixedHash);
+    // Keeps the table at most 7/8 full
+    static size_t GetGrowthLimit(const size_t capacity);
+
+    template <typename LookupKey>
+    size_t FindIndex(const size_t hash, const LookupKey& key) const;
+    // Claims a free slot for a key that is known to be absent, may grow the table
+    size_t PrepareInsert(const size_t hash);
+    size_t FindFirstFree(const size_t mixedHash) const;
+    void ResizeAndRehash(const size_t newCapacity);
+    void Allocate(const size_t capacity);
+    void Destroy();
+
+   private:
+    using CtrlAllocator = HeapAllocator<int8_t, SwissTableGroup::WIDTH>;
+
+    int8_t* mCtrl{nullptr};
+    Data* mSlots{nullptr};
+    size_t mCapacity{0};
+    size_t mElemCount{0};
+    size_t mGrowthLeft{0};
+    DataHasher mHasher;
+    Allocator mAllocator;
+};
+}  // namespace Moon
+
+#include <CollisionHandlerLib/swissTableCollisionHandler.ipp>
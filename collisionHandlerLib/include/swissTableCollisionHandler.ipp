@@ -0,0 +1,415 @@
+#pragma once
+
+#include <CollisionHandlerLib/swissTableCollisionHandler.hpp>
+#include <CommonLib/math.hpp>
+#include <HashLib/hashing.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename Data, typename DataHasher, typename Allocator>
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::SwissTableCollisionHandler(
+    const size_t bucketCount, const DataHasher& hasher, const Allocator& allocator)
+    : mHasher(hasher), mAllocator(allocator)
+{
+    if (bucketCount > 0)
+    {
+        Allocate(Util::Math::NextPowerOfTwo(std::max(bucketCount, MIN_CAPACITY)));
+    }
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::SwissTableCollisionHandler(
+    const SwissTableCollisionHandler& other)
+    : mHasher(other.mHasher), mAllocator(other.mAllocator)
+{
+    if (other.mCapacity == 0)
+    {
+        return;
+    }
+
+    // Same capacity and hash function, so every element keeps its slot
+    Allocate(other.mCapacity);
+    for (size_t i = 0; i < mCapacity; ++i)
+    {
+        if (SwissTableCtrl::IsFull(other.mCtrl[i]))
+        {
+            mAllocator.Construct(mSlots + i, other.mSlots[i]);
+        }
+    }
+    std::memcpy(mCtrl, other.mCtrl, mCapacity);
+    mElemCount = other.mElemCount;
+    mGrowthLeft = other.mGrowthLeft;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::SwissTableCollisionHandler(
+    SwissTableCollisionHandler&& other) noexcept
+    : mCtrl(other.mCtrl),
+      mSlots(other.mSlots),
+      mCapacity(other.mCapacity),
+      mElemCount(other.mElemCount),
+      mGrowthLeft(other.mGrowthLeft),
+      mHasher(std::move(other.mHasher)),
+      mAllocator(std::move(other.mAllocator))
+{
+    other.mCtrl = nullptr;
+    other.mSlots = nullptr;
+    other.mCapacity = 0;
+    other.mElemCount = 0;
+    other.mGrowthLeft = 0;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+SwissTableCollisionHandler<Data, DataHasher, Allocator>&
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::operator=(
+    const SwissTableCollisionHandler& other)
+{
+    if (this != &other)
+    {
+        SwissTableCollisionHandler copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+SwissTableCollisionHandler<Data, DataHasher, Allocator>&
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::operator=(
+    SwissTableCollisionHandler&& other) noexcept
+{
+    if (this != &other)
+    {
+        Destroy();
+        mCtrl = std::exchange(other.mCtrl, nullptr);
+        mSlots = std::exchange(other.mSlots, nullptr);
+        mCapacity = std::exchange(other.mCapacity, 0);
+        mElemCount = std::exchange(other.mElemCount, 0);
+        mGrowthLeft = std::exchange(other.mGrowthLeft, 0);
+        mHasher = std::move(other.mHasher);
+        mAllocator = std::move(other.mAllocator);
+    }
+    return *this;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::~SwissTableCollisionHandler()
+{
+    Destroy();
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+void SwissTableCollisionHandler<Data, DataHasher, Allocator>::Insert(const size_t hash,
+                                                                   const Data& data)
+{
+    const size_t index = FindIndex(hash, data.mKey);
+    if (index != NPOS)
+    {
+        mSlots[index].mValue = data.mValue;
+        return;
+    }
+    // PrepareInsert may reallocate mSlots, so it must run first
+    const size_t freeIndex = PrepareInsert(hash);
+    mAllocator.Construct(mSlots + freeIndex, data);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+template <typename LookupKey>
+bool SwissTableCollisionHandler<Data, DataHasher, Allocator>::Delete(const size_t hash,
+                                                                   const LookupKey& key)
+{
+    const size_t index = FindIndex(hash, key);
+    if (index == NPOS)
+    {
+        return false;
+    }
+
+    mAllocator.Destruct(mSlots + index);
+    --mElemCount;
+    // A probe only continues past a group without empty slots. If the group
+    // still has one, no probe sequence relies on this slot and it can become
+    // empty again instead of a tombstone.
+    const size_t groupStart = index & ~(SwissTableGroup::WIDTH - 1);
+    if (SwissTableGroup(mCtrl + groupStart).MatchEmpty() != 0)
+    {
+        mCtrl[index] = SwissTableCtrl::EMPTY;
+        ++mGrowthLeft;
+    }
+    else
+    {
+        mCtrl[index] = SwissTableCtrl::DELETED;
+    }
+    return true;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+Data& SwissTableCollisionHandler<Data, DataHasher, Allocator>::LookupOrDefaultConstruct(
+    const size_t hash, const KeyType& key)
+{
+    size_t index = FindIndex(hash, key);
+    if (index == NPOS)
+    {
+        index = PrepareInsert(hash);
+        mAllocator.Construct(mSlots + index, Data{key, {}});
+    }
+    return mSlots[index];
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+template <typename LookupKey>
+typename SwissTableCollisionHandler<Data, DataHasher, Allocator>::IteratorType
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::Find(const size_t hash,
+                                                            const LookupKey& key)
+{
+    const size_t index = FindIndex(hash, key);
+    if (index == NPOS)
+    {
+        return end();
+    }
+    return IteratorType(mCtrl + index, mSlots + index);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+void SwissTableCollisionHandler<Data, DataHasher, Allocator>::Clear()
+{
+    for (size_t i = 0; i < mCapacity; ++i)
+    {
+        if (SwissTableCtrl::IsFull(mCtrl[i]))
+        {
+            mAllocator.Destruct(mSlots + i);
+        }
+    }
+    if (mCapacity > 0)
+    {
+        std::memset(mCtrl, SwissTableCtrl::EMPTY, mCapacity);
+    }
+    mElemCount = 0;
+    mGrowthLeft = GetGrowthLimit(mCapacity);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+void SwissTableCollisionHandler<Data, DataHasher, Allocator>::Prefetch(const size_t hash) const
+{
+    if (mCapacity == 0)
+    {
+        return;
+    }
+    const size_t groupMask = mCapacity / SwissTableGroup::WIDTH - 1;
+    const size_t groupStart = (GroupIndex(Mix(hash)) & groupMask) * SwissTableGroup::WIDTH;
+    __builtin_prefetch(mCtrl + groupStart);
+    __builtin_prefetch(mSlots + groupStart);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::Size() const noexcept
+{
+    return mElemCount;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::Capacity() const noexcept
+{
+    return mCapacity;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+typename SwissTableCollisionHandler<Data, DataHasher, Allocator>::IteratorType
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::begin() const
+{
+    if (mCapacity == 0)
+    {
+        return end();
+    }
+    IteratorType it(mCtrl, mSlots);
+    it.SkipFreeSlots();
+    return it;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+typename SwissTableCollisionHandler<Data, DataHasher, Allocator>::IteratorType
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::end() const
+{
+    return IteratorType(mCtrl + mCapacity, mSlots + mCapacity);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+typename SwissTableCollisionHandler<Data, DataHasher, Allocator>::IteratorType
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::Begin() const
+{
+    return begin();
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+typename SwissTableCollisionHandler<Data, DataHasher, Allocator>::IteratorType
+SwissTableCollisionHandler<Data, DataHasher, Allocator>::End() const
+{
+    return end();
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::Mix(const size_t hash)
+{
+    // Fibonacci multiply, then fold the well mixed high half into the low half
+    const uint64_t product = Util::Hashing::FibonacciMultiply(hash);
+    return static_cast<size_t>(product ^ (product >> 32));
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::GroupIndex(const size_t mixedHash)
+{
+    return mixedHash >> 7;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+int8_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::Tag(const size_t mixedHash)
+{
+    return static_cast<int8_t>(mixedHash & 0x7F);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::GetGrowthLimit(
+    const size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+template <typename LookupKey>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::FindIndex(
+    const size_t hash, const LookupKey& key) const
+{
+    if (mCapacity == 0)
+    {
+        return NPOS;
+    }
+
+    const size_t mixedHash = Mix(hash);
+    const int8_t tag = Tag(mixedHash);
+    const size_t groupMask = mCapacity / SwissTableGroup::WIDTH - 1;
+    size_t group = GroupIndex(mixedHash) & groupMask;
+    // Triangular steps over a power of two group count visit every group
+    for (size_t step = 1;; ++step)
+    {
+        const size_t groupStart = group * SwissTableGroup::WIDTH;
+        const SwissTableGroup ctrlGroup(mCtrl + groupStart);
+        for (uint32_t match = ctrlGroup.Match(tag); match != 0; match &= match - 1)
+        {
+            const size_t index = groupStart + SwissTableGroup::LowestBit(match);
+            if (mSlots[index].mKey == key)
+            {
+                return index;
+            }
+        }
+        if (ctrlGroup.MatchEmpty() != 0 || step > groupMask)
+        {
+            return NPOS;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::FindFirstFree(
+    const size_t mixedHash) const
+{
+    const size_t groupMask = mCapacity / SwissTableGroup::WIDTH - 1;
+    size_t group = GroupIndex(mixedHash) & groupMask;
+    for (size_t step = 1;; ++step)
+    {
+        const size_t groupStart = group * SwissTableGroup::WIDTH;
+        const uint32_t free = SwissTableGroup(mCtrl + groupStart).MatchEmptyOrDeleted();
+        if (free != 0)
+        {
+            return groupStart + SwissTableGroup::LowestBit(free);
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+size_t SwissTableCollisionHandler<Data, DataHasher, Allocator>::PrepareInsert(const size_t hash)
+{
+    if (mCapacity == 0)
+    {
+        Allocate(MIN_CAPACITY);
+    }
+
+    const size_t mixedHash = Mix(hash);
+    size_t index = FindFirstFree(mixedHash);
+    if (mGrowthLeft == 0 && mCtrl[index] != SwissTableCtrl::DELETED)
+    {
+        // Out of empty slots. If enough of them are tombstones, rehashing in
+        // place reclaims them, growing would only halve the load of a table
+        // that is churning at a constant size.
+        const bool rehashInPlace = mElemCount * 32 <= mCapacity * 25;
+        ResizeAndRehash(rehashInPlace ? mCapacity : mCapacity * 2);
+        index = FindFirstFree(mixedHash);
+    }
+
+    if (mCtrl[index] == SwissTableCtrl::EMPTY)
+    {
+        --mGrowthLeft;
+    }
+    mCtrl[index] = Tag(mixedHash);
+    ++mElemCount;
+    return index;
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+void SwissTableCollisionHandler<Data, DataHasher, Allocator>::ResizeAndRehash(
+    const size_t newCapacity)
+{
+    int8_t* oldCtrl = mCtrl;
+    Data* oldSlots = mSlots;
+    const size_t oldCapacity = mCapacity;
+
+    Allocate(newCapacity);
+    for (size_t i = 0; i < oldCapacity; ++i)
+    {
+        if (SwissTableCtrl::IsFull(oldCtrl[i]))
+        {
+            const size_t mixedHash = Mix(mHasher(oldSlots[i]));
+            const size_t index = FindFirstFree(mixedHash);
+            mCtrl[index] = Tag(mixedHash);
+            mAllocator.Construct(mSlots + index, std::move(oldSlots[i]));
+            mAllocator.Destruct(oldSlots + i);
+        }
+    }
+    mGrowthLeft -= mElemCount;
+
+    mAllocator.Deallocate(oldSlots);
+    CtrlAllocator::Deallocate(oldCtrl);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+void SwissTableCollisionHandler<Data, DataHasher, Allocator>::Allocate(const size_t capacity)
+{
+    // One extra group holds the sentinel, keeping every group load in bounds
+    mCtrl = CtrlAllocator::Allocate(capacity + SwissTableGroup::WIDTH);
+    std::memset(mCtrl, SwissTableCtrl::EMPTY, capacity + SwissTableGroup::WIDTH);
+    mCtrl[capacity] = SwissTableCtrl::SENTINEL;
+    mSlots = mAllocator.Allocate(capacity);
+    mCapacity = capacity;
+    mGrowthLeft = GetGrowthLimit(capacity);
+}
+
+template <typename Data, typename DataHasher, typename Allocator>
+void SwissTableCollisionHandler<Data, DataHasher, Allocator>::Destroy()
+{
+    if (mCapacity == 0)
+    {
+        return;
+    }
+    Clear();
+    mAllocator.Deallocate(mSlots);
+    CtrlAllocator::Deallocate(mCtrl);
+    mSlots = nullptr;
+    mCtrl = nullptr;
+    mCapacity = 0;
+    mGrowthLeft = 0;
+}
+}  // namespace Moon
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Moon
+{
+
+template <typename Data, typename DataHasher, typename Allocator>
+class SwissTableCollisionHandler;
+
+// Walks the full slots in table order, the control array ends with a
+// sentinel so no bounds are needed
+template <typename T>
+class SwissTableCollisionHandlerIterator
+{
+   public:
+    // A singular iterator, only good for assigning to
+    SwissTableCollisionHandlerIterator() noexcept = default;
+
+    SwissTableCollisionHandlerIterator& operator++() noexcept;
+    SwissTableCollisionHandlerIterator operator++(int) noexcept;
+
+    bool operator==(const SwissTableCollisionHandlerIterator& other) const noexcept;
+    bool operator!=(const SwissTableCollisionHandlerIterator& other) const noexcept;
+
+    T& operator*() const noexcept;
+    T* operator->() const noexcept;
+
+   private:
+    SwissTableCollisionHandlerIterator(const int8_t* ctrl, T* slot) noexcept
+        : mCtrl(ctrl), mSlot(slot)
+    {
+    }
+    void SkipFreeSlots() noexcept;
+
+   private:
+    const int8_t* mCtrl{nullptr};
+    T* mSlot{nullptr};
+
+    template <typename Data, typename DataHasher, typename Allocator>
+    friend class SwissTableCollisionHandler;
+};
+}  // namespace Moon
+
+#include <CollisionHandlerLib/swissTableCollisionHandlerIterator.ipp>
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <CollisionHandlerLib/swissTableCollisionHandlerIterator.hpp>
+#include <CollisionHandlerLib/swissTableGroup.hpp>
+
+namespace Moon
+{
+
+template <typename T>
+SwissTableCollisionHandlerIterator<T>& SwissTableCollisionHandlerIterator<T>::operator++() noexcept
+{
+    ++mCtrl;
+    ++mSlot;
+    SkipFreeSlots();
+    return *this;
+}
+
+template <typename T>
+SwissTableCollisionHandlerIterator<T> SwissTableCollisionHandlerIterator<T>::operator++(int) noexcept
+{
+    SwissTableCollisionHandlerIterator<T> temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <typename T>
+bool SwissTableCollisionHandlerIterator<T>::operator==(
+    const SwissTableCollisionHandlerIterator& other) const noexcept
+{
+    return mSlot == other.mSlot;
+}
+
+template <typename T>
+bool SwissTableCollisionHandlerIterator<T>::operator!=(
+    const SwissTableCollisionHandlerIterator& other) const noexcept
+{
+    return mSlot != other.mSlot;
+}
+
+template <typename T>
+T& SwissTableCollisionHandlerIterator<T>::operator*() const noexcept
+{
+    return *mSlot;
+}
+
+template <typename T>
+T* SwissTableCollisionHandlerIterator<T>::operator->() const noexcept
+{
+    return mSlot;
+}
+
+template <typename T>
+void SwissTableCollisionHandlerIterator<T>::SkipFreeSlots() noexcept
+{
+    // Empty and deleted are both below the sentinel, full slots are above it
+    while (*mCtrl < SwissTableCtrl::SENTINEL)
+    {
+        ++mCtrl;
+        ++mSlot;
+    }
+}
+}  // namespace Moon
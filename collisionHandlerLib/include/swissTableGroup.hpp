@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace Moon
+{
+
+// Control byte of a SwissTable slot. Full slots hold the 7-bit hash tag
+// (0..127), the special values are all negative.
+struct SwissTableCtrl
+{
+    static constexpr int8_t EMPTY = -128;
+    static constexpr int8_t DELETED = -2;
+    // Placed after the last slot, stops iteration without a bounds check
+    static constexpr int8_t SENTINEL = -1;
+
+    static bool IsFull(const int8_t ctrl)
+    {
+        return ctrl >= 0;
+    }
+};
+
+// 16 control bytes matched at once, bit i of a returned mask is set when
+// slot i of the group matches. Falls back to a byte loop without SSE2.
+class SwissTableGroup
+{
+   public:
+    static constexpr size_t WIDTH = 16;
+
+    // ctrl must be WIDTH aligned
+    explicit SwissTableGroup(const int8_t* ctrl)
+#ifdef __SSE2__
+        : mCtrl(_mm_load_si128(reinterpret_cast<const __m128i*>(ctrl)))
+#else
+        : mCtrl(ctrl)
+#endif
+    {
+    }
+
+    uint32_t Match(const int8_t tag) const
+    {
+#ifdef __SSE2__
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), mCtrl)));
+#else
+        return MatchIf([tag](const int8_t ctrl) { return ctrl == tag; });
+#endif
+    }
+
+    uint32_t MatchEmpty() const
+    {
+        return Match(SwissTableCtrl::EMPTY);
+    }
+
+    uint32_t MatchEmptyOrDeleted() const
+    {
+#ifdef __SSE2__
+        return static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_cmpgt_epi8(_mm_set1_epi8(SwissTableCtrl::SENTINEL), mCtrl)));
+#else
+        return MatchIf([](const int8_t ctrl) { return ctrl < SwissTableCtrl::SENTINEL; });
+#endif
+    }
+
+    static size_t LowestBit(const uint32_t mask)
+    {
+        return static_cast<size_t>(__builtin_ctz(mask));
+    }
+
+   private:
+#ifdef __SSE2__
+    __m128i mCtrl;
+#else
+    template <typename Predicate>
+    uint32_t MatchIf(Predicate predicate) const
+    {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < WIDTH; ++i)
+        {
+            mask |= static_cast<uint32_t>(predicate(mCtrl[i])) << i;
+        }
+        return mask;
+    }
+
+    const int8_t* mCtrl;
+#endif
+};
+}  // namespace Moon
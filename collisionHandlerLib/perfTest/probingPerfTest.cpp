@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct Entry
+{
+    uint64_t mKey;
+    uint64_t mValue;
+};
+
+struct EntryHasher
+{
+    size_t operator()(const Entry& entry) const
+    {
+        return entry.mKey;
+    }
+};
+
+template <typename ProbingPolicy, typename SizingPolicy = Moon::PowerOfTwoSizing>
+using Handler = Moon::OpenAddressingCollisionHandler<Entry, EntryHasher, Moon::HeapAllocator<Entry>,
+                                                     ProbingPolicy, SizingPolicy>;
+
+static constexpr size_t CAPACITY = 1 << 16;
+
+// Load factor in percent
+static void LoadFactorArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(50)->Arg(75)->Arg(85)->Arg(90)->Arg(95);
+}
+
+// Random keys are their own hash, so every policy sees uniformly spread homes
+static std::vector<uint64_t> MakeKeys(const size_t count, const uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> keys(count);
+    for (auto& key : keys)
+    {
+        key = rng();
+    }
+    return keys;
+}
+
+template <typename ProbingPolicy>
+static Handler<ProbingPolicy> MakeHandler(const std::vector<uint64_t>& keys)
+{
+    Handler<ProbingPolicy> handler(CAPACITY);
+    handler.SetMaxLoadFactor(0.96);
+    for (const auto key : keys)
+    {
+        handler.Insert(key, Entry{key, key});
+    }
+    return handler;
+}
+
+// Replaces every key once, leaving the load unchanged. Linear and quadratic
+// probing accumulate tombstones along the way, Robin Hood does not.
+template <typename ProbingPolicy>
+static void Churn(Handler<ProbingPolicy>& handler, std::vector<uint64_t>& keys)
+{
+    const auto newKeys = MakeKeys(keys.size(), keys.size() + 1);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        handler.Delete(keys[i], keys[i]);
+        handler.Insert(newKeys[i], Entry{newKeys[i], newKeys[i]});
+    }
+    keys = newKeys;
+}
+
+template <typename ProbingPolicy>
+static void ReportProbeLengths(benchmark::State& state, const Handler<ProbingPolicy>& handler,
+                               const std::vector<uint64_t>& keys,
+                               const std::vector<uint64_t>& missingKeys)
+{
+    double hitProbes = 0;
+    double missProbes = 0;
+    for (const auto key : keys)
+    {
+        hitProbes += handler.ProbeLength(key, key);
+    }
+    for (const auto key : missingKeys)
+    {
+        missProbes += handler.ProbeLength(key, key);
+    }
+    state.counters["hitProbes"] = hitProbes / keys.size();
+    state.counters["missProbes"] = missProbes / missingKeys.size();
+}
+
+template <typename ProbingPolicy>
+static void BM_FindHit(benchmark::State& state)
+{
+    const auto keys = MakeKeys(CAPACITY * state.range(0) / 100, 1);
+    auto handler = MakeHandler<ProbingPolicy>(keys);
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (const auto key : keys)
+        {
+            sum += handler.Find(key, key)->mValue;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+    ReportProbeLengths(state, handler, keys, MakeKeys(keys.size(), 0));
+}
+
+template <typename ProbingPolicy>
+static void BM_FindMiss(benchmark::State& state)
+{
+    const auto keys = MakeKeys(CAPACITY * state.range(0) / 100, 1);
+    const auto missingKeys = MakeKeys(keys.size(), 0);
+    auto handler = MakeHandler<ProbingPolicy>(keys);
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (const auto key : missingKeys)
+        {
+            found += handler.Find(key, key) != handler.End();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * missingKeys.size());
+    ReportProbeLengths(state, handler, keys, missingKeys);
+}
+
+template <typename ProbingPolicy>
+static void BM_FindMissAfterChurn(benchmark::State& state)
+{
+    auto keys = MakeKeys(CAPACITY * state.range(0) / 100, 1);
+    const auto missingKeys = MakeKeys(keys.size(), 0);
+    auto handler = MakeHandler<ProbingPolicy>(keys);
+    Churn(handler, keys);
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (const auto key : missingKeys)
+        {
+            found += handler.Find(key, key) != handler.End();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * missingKeys.size());
+    ReportProbeLengths(state, handler, keys, missingKeys);
+}
+
+// Keys 0, 1, 2, ... hashed by identity like std::hash<int>, from an empty
+// table so growth is included
+template <typename SizingPolicy>
+static void BM_InsertFindSequentialKeys(benchmark::State& state)
+{
+    const auto keyCount = static_cast<uint64_t>(state.range(0));
+    for (auto _ : state)
+    {
+        Handler<Moon::LinearProbing, SizingPolicy> handler;
+        for (uint64_t key = 0; key < keyCount; ++key)
+        {
+            handler.Insert(key, Entry{key, key});
+        }
+        uint64_t sum = 0;
+        for (uint64_t key = 0; key < keyCount; ++key)
+        {
+            sum += handler.Find(key, key)->mValue;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * keyCount);
+}
+
+BENCHMARK_TEMPLATE(BM_FindHit, Moon::LinearProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, Moon::QuadraticProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, Moon::RobinHoodProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindMiss, Moon::LinearProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindMiss, Moon::QuadraticProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindMiss, Moon::RobinHoodProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindMissAfterChurn, Moon::LinearProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindMissAfterChurn, Moon::QuadraticProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_FindMissAfterChurn, Moon::RobinHoodProbing)->Apply(LoadFactorArguments);
+BENCHMARK_TEMPLATE(BM_InsertFindSequentialKeys, Moon::PowerOfTwoSizing)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertFindSequentialKeys, Moon::PrimeSizing)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct Entry
+{
+    uint64_t mKey;
+    uint64_t mValue;
+};
+
+struct EntryHasher
+{
+    size_t operator()(const Entry& entry) const
+    {
+        return entry.mKey;
+    }
+};
+
+template <typename RehashPolicy>
+using Handler = Moon::OpenAddressingCollisionHandler<Entry, EntryHasher, Moon::HeapAllocator<Entry>,
+                                                     Moon::LinearProbing, Moon::PowerOfTwoSizing,
+                                                     RehashPolicy>;
+
+// Inserts into an empty table, so every doubling up to the final size is
+// paid inside the timed loop. Reports the tail of the per insert latency,
+// which is where stop-the-world rehashing shows up.
+template <typename RehashPolicy>
+static void BM_InsertLatency(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::mt19937_64 rng(1);
+    std::vector<uint64_t> keys(count);
+    for (auto& key : keys)
+    {
+        key = rng();
+    }
+
+    std::vector<int64_t> latencies;
+    latencies.reserve(count * state.max_iterations);
+    for (auto _ : state)
+    {
+        Handler<RehashPolicy> handler;
+        for (const auto key : keys)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            handler.Insert(key, Entry{key, key});
+            const auto stop = std::chrono::steady_clock::now();
+            latencies.push_back(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        }
+        benchmark::DoNotOptimize(handler.Size());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](const double share) {
+        return static_cast<double>(latencies[static_cast<size_t>(share * (latencies.size() - 1))]);
+    };
+    state.counters["p99ns"] = percentile(0.99);
+    state.counters["p999ns"] = percentile(0.999);
+    state.counters["maxns"] = static_cast<double>(latencies.back());
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(BM_InsertLatency, Moon::StopTheWorldRehash)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertLatency, Moon::IncrementalRehash<4>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertLatency, Moon::IncrementalRehash<16>)->Arg(1 << 16)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1 @@
+#include <CollisionHandlerLib/swissTableCollisionHandler.hpp>
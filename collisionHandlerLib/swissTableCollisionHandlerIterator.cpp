@@ -0,0 +1 @@
+#include <CollisionHandlerLib/swissTableCollisionHandlerIterator.hpp>
@@ -0,0 +1,425 @@
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <CommonTestLib/dummy.hpp>
+#include <CommonTestLib/dummyTracker.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace Moon::Test
+{
+using Dummy = Moon::Common::Test::Dummy;
+
+struct IntPair
+{
+    int mKey;
+    int mValue;
+};
+
+struct IntPairHasher
+{
+    size_t operator()(const IntPair& pair) const
+    {
+        return static_cast<size_t>(pair.mKey);
+    }
+};
+
+struct ZeroHasher
+{
+    size_t operator()(const IntPair&) const
+    {
+        return 0;
+    }
+};
+
+struct DummyPair
+{
+    int mKey;
+    Dummy mValue;
+};
+
+struct DummyPairHasher
+{
+    size_t operator()(const DummyPair& pair) const
+    {
+        return static_cast<size_t>(pair.mKey);
+    }
+};
+
+// Smallest hash whose home is the given slot in a table of that capacity
+template <typename SizingPolicy>
+size_t HashWithHome(const size_t slot, const size_t capacity)
+{
+    SizingPolicy sizing;
+    sizing.Resize(capacity);
+    size_t hash = 0;
+    while (sizing.Home(hash) != slot)
+    {
+        ++hash;
+    }
+    return hash;
+}
+
+// Parameterised by a std::pair of probing and sizing policy
+template <typename Policies>
+class OpenAddressingFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+        dummyTracker = new DummyTracker();
+        Dummy::tracker = dummyTracker;
+    }
+
+    void TearDown() override
+    {
+        delete dummyTracker;
+        Dummy::tracker = nullptr;
+    }
+
+    using ProbingPolicy = typename Policies::first_type;
+    using SizingPolicy = typename Policies::second_type;
+    using Handler = OpenAddressingCollisionHandler<IntPair, IntPairHasher, HeapAllocator<IntPair>,
+                                                   ProbingPolicy, SizingPolicy>;
+
+    DummyTracker* dummyTracker;
+};
+
+using Policies = ::testing::Types<std::pair<LinearProbing, PowerOfTwoSizing>,
+                                  std::pair<QuadraticProbing, PowerOfTwoSizing>,
+                                  std::pair<RobinHoodProbing, PowerOfTwoSizing>,
+                                  std::pair<LinearProbing, PrimeSizing>,
+                                  std::pair<RobinHoodProbing, PrimeSizing>>;
+TYPED_TEST_SUITE(OpenAddressingFixture, Policies);
+
+TYPED_TEST(OpenAddressingFixture, WHEN_elements_are_inserted_THEN_load_stays_below_three_quarters)
+{
+    typename TestFixture::Handler handler;
+    for (int i = 0; i < 10000; ++i)
+    {
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+        EXPECT_LE(handler.Size() * 4, handler.Capacity() * 3);
+    }
+    for (int i = 0; i < 10000; ++i)
+    {
+        ASSERT_NE(handler.Find(static_cast<size_t>(i), i), handler.End());
+    }
+}
+
+TYPED_TEST(OpenAddressingFixture, WHEN_keys_collide_THEN_deleted_slots_keep_probe_sequence_intact)
+{
+    typename TestFixture::Handler handler;
+    // Every key starts probing at the same slot
+    for (int i = 0; i < 10; ++i)
+    {
+        handler.Insert(0, IntPair{i, i});
+    }
+    EXPECT_TRUE(handler.Delete(0, 3));
+    EXPECT_FALSE(handler.Delete(0, 3));
+
+    EXPECT_EQ(handler.Find(0, 3), handler.End());
+    for (int i = 4; i < 10; ++i)
+    {
+        ASSERT_NE(handler.Find(0, i), handler.End());
+        EXPECT_EQ(handler.Find(0, i)->mValue, i);
+    }
+}
+
+TYPED_TEST(OpenAddressingFixture, WHEN_churning_at_constant_size_THEN_capacity_does_not_grow)
+{
+    typename TestFixture::Handler handler(64);
+    for (int i = 0; i < 20; ++i)
+    {
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+    }
+    const auto capacity = handler.Capacity();
+    for (int i = 20; i < 100000; ++i)
+    {
+        handler.Delete(static_cast<size_t>(i - 20), i - 20);
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+    }
+    EXPECT_EQ(handler.Size(), 20);
+    EXPECT_EQ(handler.Capacity(), capacity);
+}
+
+TYPED_TEST(OpenAddressingFixture, WHEN_handler_is_iterated_THEN_only_live_elements_are_visited)
+{
+    typename TestFixture::Handler handler;
+    EXPECT_EQ(handler.Begin(), handler.End());
+    for (int i = 0; i < 100; ++i)
+    {
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+    }
+    for (int i = 0; i < 100; i += 2)
+    {
+        handler.Delete(static_cast<size_t>(i), i);
+    }
+
+    std::set<int> visited;
+    for (const auto& pair : handler)
+    {
+        EXPECT_EQ(pair.mKey % 2, 1);
+        EXPECT_TRUE(visited.insert(pair.mKey).second);
+    }
+    EXPECT_EQ(visited.size(), 50);
+}
+
+TYPED_TEST(OpenAddressingFixture, WHEN_table_grows_THEN_elements_are_moved_not_copied)
+{
+    using ::testing::AnyNumber;
+    EXPECT_CALL(*this->dummyTracker, ArgConstructor()).Times(AnyNumber());
+    EXPECT_CALL(*this->dummyTracker, CopyConstructor()).Times(100);
+    EXPECT_CALL(*this->dummyTracker, MoveConstructor()).Times(AnyNumber());
+    EXPECT_CALL(*this->dummyTracker, Destructor()).Times(AnyNumber());
+
+    OpenAddressingCollisionHandler<DummyPair, DummyPairHasher, HeapAllocator<DummyPair>,
+                                   typename TestFixture::ProbingPolicy,
+                                   typename TestFixture::SizingPolicy>
+        handler;
+    for (int i = 0; i < 100; ++i)
+    {
+        // The only copies are the ones into the table
+        const DummyPair pair{i, Dummy(i)};
+        handler.Insert(static_cast<size_t>(i), pair);
+    }
+    EXPECT_EQ(handler.Size(), 100);
+}
+
+TYPED_TEST(OpenAddressingFixture, WHEN_handler_is_copied_THEN_copy_is_independent)
+{
+    typename TestFixture::Handler handler;
+    for (int i = 0; i < 100; ++i)
+    {
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+    }
+
+    typename TestFixture::Handler copy(handler);
+    handler.Delete(5, 5);
+    handler.Insert(6, IntPair{6, -6});
+
+    ASSERT_NE(copy.Find(5, 5), copy.End());
+    EXPECT_EQ(copy.Find(6, 6)->mValue, 6);
+    EXPECT_EQ(handler.Find(5, 5), handler.End());
+
+    typename TestFixture::Handler moved(std::move(copy));
+    EXPECT_EQ(moved.Size(), 100);
+    EXPECT_EQ(copy.Size(), 0);
+    EXPECT_EQ(copy.Begin(), copy.End());
+}
+TYPED_TEST(OpenAddressingFixture, WHEN_max_load_factor_is_raised_THEN_table_fills_further)
+{
+    typename TestFixture::Handler handler(1024);
+    handler.SetMaxLoadFactor(0.95);
+    for (int i = 0; i < 972; ++i)
+    {
+        const int key = i * 7919;
+        handler.Insert(static_cast<size_t>(key), IntPair{key, i});
+    }
+    const size_t capacity = handler.Capacity();
+    EXPECT_LT(capacity, 1100);
+    for (int i = 0; i < 972; ++i)
+    {
+        const int key = i * 7919;
+        ASSERT_NE(handler.Find(static_cast<size_t>(key), key), handler.End());
+    }
+
+    // Lowering it again grows the table right away
+    handler.SetMaxLoadFactor(0.5);
+    EXPECT_GT(handler.Capacity(), capacity);
+    EXPECT_EQ(handler.Size(), 972);
+    EXPECT_THROW(handler.SetMaxLoadFactor(1.0), std::out_of_range);
+}
+
+TYPED_TEST(OpenAddressingFixture, WHEN_probe_length_is_queried_THEN_it_counts_inspected_slots)
+{
+    typename TestFixture::Handler handler(16);
+    const size_t capacity = handler.Capacity();
+    const size_t otherHash = HashWithHome<typename TestFixture::SizingPolicy>(5, capacity);
+    EXPECT_EQ(handler.ProbeLength(0, 0), 1);
+    handler.Insert(0, IntPair{0, 0});
+    handler.Insert(0, IntPair{1, 1});
+    EXPECT_EQ(handler.ProbeLength(0, 0), 1);
+    EXPECT_EQ(handler.ProbeLength(0, 1), 2);
+    EXPECT_EQ(handler.ProbeLength(otherHash, 5), 1);
+}
+
+template <typename ProbingPolicy, size_t Step>
+using IncrementalHandler =
+    OpenAddressingCollisionHandler<IntPair, IntPairHasher, HeapAllocator<IntPair>, ProbingPolicy,
+                                   PowerOfTwoSizing, IncrementalRehash<Step>>;
+
+template <typename Handler>
+class IncrementalRehashFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+
+    // Inserts keys from 0 until an insert starts a rehash, returns the count
+    static int FillUntilRehashing(Handler& handler)
+    {
+        int key = 0;
+        while (!handler.IsRehashing())
+        {
+            handler.Insert(static_cast<size_t>(key), IntPair{key, key});
+            ++key;
+        }
+        return key;
+    }
+};
+
+using IncrementalHandlers =
+    ::testing::Types<IncrementalHandler<LinearProbing, 1>, IncrementalHandler<LinearProbing, 4>,
+                     IncrementalHandler<QuadraticProbing, 4>, IncrementalHandler<RobinHoodProbing, 1>,
+                     IncrementalHandler<RobinHoodProbing, 4>>;
+TYPED_TEST_SUITE(IncrementalRehashFixture, IncrementalHandlers);
+
+TYPED_TEST(IncrementalRehashFixture, WHEN_table_grows_THEN_old_table_is_drained_by_later_operations)
+{
+    TypeParam handler;
+    const int count = TestFixture::FillUntilRehashing(handler);
+    const size_t capacity = handler.Capacity();
+
+    // Lookups alone move the migration forward
+    size_t lookups = 0;
+    while (handler.IsRehashing())
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            ASSERT_NE(handler.Find(static_cast<size_t>(i), i), handler.End());
+            ++lookups;
+        }
+    }
+    EXPECT_EQ(handler.Capacity(), capacity);
+    EXPECT_EQ(handler.Size(), count);
+    EXPECT_GT(lookups, 0);
+}
+
+TYPED_TEST(IncrementalRehashFixture, WHEN_migration_is_in_progress_THEN_iteration_visits_both_tables)
+{
+    TypeParam handler;
+    const int count = TestFixture::FillUntilRehashing(handler);
+    handler.Find(0, 0);
+    ASSERT_TRUE(handler.IsRehashing());
+
+    std::set<int> visited;
+    for (const auto& pair : handler)
+    {
+        EXPECT_TRUE(visited.insert(pair.mKey).second);
+    }
+    EXPECT_EQ(visited.size(), count);
+
+    // Copies keep elements of both tables, deletes reach into the old one
+    TypeParam copy(handler);
+    EXPECT_FALSE(copy.IsRehashing());
+    for (int i = 0; i < count; i += 2)
+    {
+        EXPECT_TRUE(handler.Delete(static_cast<size_t>(i), i));
+    }
+    EXPECT_EQ(handler.Size(), count / 2);
+    EXPECT_EQ(copy.Size(), count);
+    for (int i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(handler.Find(static_cast<size_t>(i), i) != handler.End(), i % 2 == 1);
+        ASSERT_NE(copy.Find(static_cast<size_t>(i), i), copy.End());
+    }
+}
+
+TYPED_TEST(IncrementalRehashFixture, WHEN_random_operations_are_applied_THEN_handler_matches_unordered_map)
+{
+    TypeParam handler;
+    std::unordered_map<int, int> expected;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> keys(0, 4000);
+    for (int i = 0; i < 50000; ++i)
+    {
+        const int key = keys(generator);
+        const size_t hash = static_cast<size_t>(key);
+        switch (generator() % 4)
+        {
+            case 0:
+            case 1:
+                handler.Insert(hash, IntPair{key, i});
+                expected[key] = i;
+                break;
+            case 2:
+                ASSERT_EQ(handler.Delete(hash, key), expected.erase(key) == 1);
+                break;
+            default:
+            {
+                const auto it = handler.Find(hash, key);
+                const auto expectedIt = expected.find(key);
+                ASSERT_EQ(it != handler.End(), expectedIt != expected.end());
+                if (expectedIt != expected.end())
+                {
+                    ASSERT_EQ(it->mValue, expectedIt->second);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(handler.Size(), expected.size());
+    }
+
+    size_t visited = 0;
+    for (const auto& pair : handler)
+    {
+        ASSERT_EQ(expected.at(pair.mKey), pair.mValue);
+        ++visited;
+    }
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST(RobinHoodProbingTest, WHEN_elements_are_deleted_THEN_runs_shift_back_and_probes_stay_short)
+{
+    OpenAddressingCollisionHandler<IntPair, IntPairHasher, HeapAllocator<IntPair>, RobinHoodProbing>
+        handler(16);
+    const size_t hash100 = HashWithHome<PowerOfTwoSizing>(4, 16);
+    // Keys 0..4 all start at slot 0, key 100 starts at slot 4
+    for (int i = 0; i < 5; ++i)
+    {
+        handler.Insert(0, IntPair{i, i});
+    }
+    handler.Insert(hash100, IntPair{100, 100});
+    // Robin Hood keeps the home run of slot 0 together, key 100 moves behind it
+    EXPECT_EQ(handler.ProbeLength(hash100, 100), 2);
+    // A miss stops at the first element closer to its home than the key
+    EXPECT_EQ(handler.ProbeLength(0, 42), 6);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(handler.Delete(0, i));
+    }
+    // No tombstones are left behind, key 100 is back at its home slot
+    EXPECT_EQ(handler.ProbeLength(hash100, 100), 1);
+    EXPECT_EQ(handler.ProbeLength(0, 0), 1);
+    EXPECT_EQ(handler.Size(), 1);
+}
+
+TEST(RobinHoodProbingTest, WHEN_a_run_exceeds_the_stored_distance_THEN_elements_are_still_found)
+{
+    OpenAddressingCollisionHandler<IntPair, ZeroHasher, HeapAllocator<IntPair>, RobinHoodProbing>
+        handler;
+    // Every key hashes to 0, the run grows past what a state byte can hold
+    for (int i = 0; i < 600; ++i)
+    {
+        handler.Insert(0, IntPair{i, i});
+    }
+    for (int i = 0; i < 600; i += 2)
+    {
+        EXPECT_TRUE(handler.Delete(0, i));
+    }
+    for (int i = 0; i < 600; ++i)
+    {
+        EXPECT_EQ(handler.Find(0, i) != handler.End(), i % 2 == 1);
+    }
+}
+}  // namespace Moon::Test
@@ -0,0 +1,75 @@
+#include <CollisionHandlerLib/sizingPolicy.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+
+namespace Moon::Test
+{
+
+TEST(SizingPolicyTest, WHEN_power_of_two_sizing_rounds_up_THEN_capacity_doubles_from_next_power)
+{
+    EXPECT_EQ(PowerOfTwoSizing::RoundUp(16), 16);
+    EXPECT_EQ(PowerOfTwoSizing::RoundUp(17), 32);
+    EXPECT_EQ(PowerOfTwoSizing::Grow(32), 64);
+
+    PowerOfTwoSizing sizing;
+    sizing.Resize(64);
+    EXPECT_EQ(sizing.Wrap(64), 0);
+    EXPECT_EQ(sizing.Wrap(70), 6);
+}
+
+TEST(SizingPolicyTest, WHEN_sequential_keys_are_mapped_THEN_power_of_two_homes_do_not_cluster)
+{
+    // std::hash<int> is the identity, a plain mask would use the low bits only
+    PowerOfTwoSizing sizing;
+    sizing.Resize(1024);
+    std::set<size_t> homes;
+    for (size_t key = 0; key < 1024 * 64; key += 64)
+    {
+        const size_t home = sizing.Home(key);
+        EXPECT_LT(home, 1024);
+        homes.insert(home);
+    }
+    EXPECT_GT(homes.size(), 1024 / 2);
+}
+
+TEST(SizingPolicyTest, WHEN_prime_sizing_rounds_up_THEN_capacity_is_the_next_listed_prime)
+{
+    EXPECT_EQ(PrimeSizing::RoundUp(16), 17);
+    EXPECT_EQ(PrimeSizing::RoundUp(17), 17);
+    EXPECT_EQ(PrimeSizing::RoundUp(18), 37);
+    EXPECT_EQ(PrimeSizing::Grow(17), 37);
+    EXPECT_EQ(PrimeSizing::RoundUp(UINT32_MAX - 4), 4294967291u);
+    EXPECT_THROW(PrimeSizing::RoundUp(UINT32_MAX), std::length_error);
+
+    PrimeSizing sizing;
+    sizing.Resize(37);
+    EXPECT_EQ(sizing.Wrap(36), 36);
+    EXPECT_EQ(sizing.Wrap(37), 0);
+    EXPECT_EQ(sizing.Wrap(40), 3);
+}
+
+TEST(SizingPolicyTest, WHEN_prime_sizing_maps_a_hash_THEN_it_matches_the_folded_modulo)
+{
+    std::mt19937_64 rng(7);
+    for (size_t capacity = 16; capacity < UINT32_MAX; capacity = PrimeSizing::Grow(capacity))
+    {
+        PrimeSizing sizing;
+        sizing.Resize(capacity);
+        for (int i = 0; i < 1000; ++i)
+        {
+            const uint64_t hash = rng();
+            const uint32_t folded = static_cast<uint32_t>(hash ^ (hash >> 32));
+            ASSERT_EQ(sizing.Home(hash), folded % capacity);
+        }
+        if (capacity == 4294967291u)
+        {
+            break;
+        }
+    }
+}
+}  // namespace Moon::Test
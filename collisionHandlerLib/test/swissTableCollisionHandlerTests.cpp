@@ -0,0 +1,104 @@
+#include <CollisionHandlerLib/swissTableCollisionHandler.hpp>
+#include <CollisionHandlerLib/swissTableGroup.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace Moon::Test
+{
+
+struct IntPair
+{
+    int mKey;
+    int mValue;
+};
+
+struct IntPairHasher
+{
+    size_t operator()(const IntPair& pair) const
+    {
+        return static_cast<size_t>(pair.mKey);
+    }
+};
+
+using Handler = SwissTableCollisionHandler<IntPair, IntPairHasher>;
+
+TEST(SwissTableGroupTest, WHEN_group_is_matched_THEN_mask_marks_matching_slots)
+{
+    alignas(SwissTableGroup::WIDTH) int8_t ctrl[SwissTableGroup::WIDTH];
+    for (size_t i = 0; i < SwissTableGroup::WIDTH; ++i)
+    {
+        ctrl[i] = static_cast<int8_t>(i % 4);
+    }
+    ctrl[1] = SwissTableCtrl::EMPTY;
+    ctrl[6] = SwissTableCtrl::DELETED;
+    ctrl[15] = SwissTableCtrl::SENTINEL;
+
+    const SwissTableGroup group(ctrl);
+    EXPECT_EQ(group.Match(0), (1u << 0) | (1u << 4) | (1u << 8) | (1u << 12));
+    EXPECT_EQ(group.MatchEmpty(), 1u << 1);
+    EXPECT_EQ(group.MatchEmptyOrDeleted(), (1u << 1) | (1u << 6));
+    EXPECT_EQ(SwissTableGroup::LowestBit(group.Match(3)), 3);
+}
+
+TEST(SwissTableCollisionHandlerTest, WHEN_table_fills_up_THEN_load_stays_below_seven_eighths)
+{
+    Handler handler;
+    EXPECT_EQ(handler.Capacity(), 0);
+    for (int i = 0; i < 10000; ++i)
+    {
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+        EXPECT_LE(handler.Size() * 8, handler.Capacity() * 7);
+    }
+    EXPECT_EQ(handler.Capacity() & (handler.Capacity() - 1), 0);
+}
+
+TEST(SwissTableCollisionHandlerTest, WHEN_bucket_count_is_given_THEN_capacity_is_a_power_of_two_group_multiple)
+{
+    Handler handler(100);
+    EXPECT_EQ(handler.Capacity(), 128);
+    Handler tiny(3);
+    EXPECT_EQ(tiny.Capacity(), SwissTableGroup::WIDTH);
+}
+
+TEST(SwissTableCollisionHandlerTest, WHEN_churning_at_constant_size_THEN_capacity_does_not_grow)
+{
+    Handler handler(64);
+    for (int i = 0; i < 40; ++i)
+    {
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+    }
+    const auto capacity = handler.Capacity();
+    for (int i = 40; i < 100000; ++i)
+    {
+        handler.Delete(static_cast<size_t>(i - 40), i - 40);
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+    }
+    EXPECT_EQ(handler.Size(), 40);
+    EXPECT_EQ(handler.Capacity(), capacity);
+}
+
+TEST(SwissTableCollisionHandlerTest, WHEN_handler_is_copied_THEN_copy_is_independent)
+{
+    Handler handler;
+    for (int i = 0; i < 100; ++i)
+    {
+        handler.Insert(static_cast<size_t>(i), IntPair{i, i});
+    }
+
+    Handler copy(handler);
+    handler.Delete(5, 5);
+    handler.Insert(6, IntPair{6, -6});
+
+    ASSERT_NE(copy.Find(5, 5), copy.End());
+    EXPECT_EQ(copy.Find(6, 6)->mValue, 6);
+    EXPECT_EQ(handler.Find(5, 5), handler.End());
+
+    Handler moved(std::move(copy));
+    EXPECT_EQ(moved.Size(), 100);
+    EXPECT_EQ(copy.Size(), 0);
+    EXPECT_EQ(copy.Begin(), copy.End());
+}
+}  // namespace Moon::Test
@@ -0,0 +1 @@
+#include <HashLib/hash.hpp>
@@ -0,0 +1 @@
+#include <HashLib/hashing.hpp>
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <HashLib/hashing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Moon
+{
+
+// Anything std::tuple_size knows, std::pair, std::tuple and std::array among them
+template <typename T, typename = void>
+struct IsTupleLike : std::false_type
+{
+};
+
+template <typename T>
+struct IsTupleLike<T, std::void_t<decltype(std::tuple_size<T>::value)>> : std::true_type
+{
+};
+
+// Structs opt into hashing by returning their fields from HashFields(),
+// usually as std::tie(mA, mB)
+template <typename T, typename = void>
+struct HasHashFields : std::false_type
+{
+};
+
+template <typename T>
+struct HasHashFields<T, std::void_t<decltype(std::declval<const T&>().HashFields())>>
+    : std::true_type
+{
+};
+
+template <typename T>
+constexpr bool IsStringLike = std::is_convertible_v<const T&, std::string_view>;
+
+// Bytes of a floating point value that hold it. The x87 extended precision
+// long double keeps its 10 bytes first and leaves the rest of its 12 or 16
+// indeterminate, they must not reach the hash.
+template <typename T>
+constexpr size_t SignificantBytes()
+{
+    static_assert(std::is_floating_point_v<T>);
+    if constexpr (std::numeric_limits<T>::digits == 64 && std::numeric_limits<T>::is_iec559 &&
+                  sizeof(T) > 10)
+    {
+        return 10;
+    }
+    else
+    {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                          std::numeric_limits<T>::digits == 113,
+                      "no known layout for this long double, its padding could be hashed");
+        return sizeof(T);
+    }
+}
+
+// Hash of a single value, shared by every Hash specialisation so that
+// composite keys hash their members the same way a key of that type would
+template <typename T>
+uint64_t HashValue(const T& value)
+{
+    if constexpr (IsStringLike<T>)
+    {
+        const std::string_view view(value);
+        return Util::Hashing::Bytes(view.data(), view.size());
+    }
+    else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+    {
+        return Util::Hashing::Mix(static_cast<uint64_t>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        // 0.0 and -0.0 compare equal and have to hash alike
+        const T normalised = value == T(0) ? T(0) : value;
+        return Util::Hashing::Bytes(&normalised, SignificantBytes<T>());
+    }
+    else if constexpr (std::is_pointer_v<T>)
+    {
+        return Util::Hashing::Mix(reinterpret_cast<uintptr_t>(value));
+    }
+    else if constexpr (HasHashFields<T>::value)
+    {
+        return HashValue(value.HashFields());
+    }
+    else if constexpr (IsTupleLike<T>::value)
+    {
+        return std::apply(
+            [](const auto&... elements) {
+                uint64_t hash = std::tuple_size<T>::value;
+                ((hash = Util::Hashing::Combine(hash, HashValue(elements))), ...);
+                return hash;
+            },
+            value);
+    }
+    else
+    {
+        static_assert(std::is_default_constructible_v<std::hash<T>>,
+                      "T needs HashFields() or a std::hash specialisation");
+        // std::hash is often the identity, mix it before a table sees it
+        return Util::Hashing::Mix(static_cast<uint64_t>(std::hash<T>()(value)));
+    }
+}
+
+// Drop-in Hasher for HashMap. Integers, enums and pointers go through a full
+// avalanche mixer, strings and floating point values through the wyhash byte
+// hasher, tuples, pairs, arrays and structs with HashFields() combine the
+// hashes of their members, anything else mixes its std::hash.
+template <typename T, typename = void>
+struct Hash
+{
+    size_t operator()(const T& value) const
+    {
+        return static_cast<size_t>(HashValue(value));
+    }
+};
+
+// String keys can be looked up by std::string_view or const char* without
+// building a temporary key
+template <typename T>
+struct Hash<T, std::enable_if_t<IsStringLike<T>>>
+{
+    using is_transparent = void;
+
+    size_t operator()(const std::string_view value) const
+    {
+        return static_cast<size_t>(HashValue(value));
+    }
+};
+
+// Hasher for keys known at compile time, see ConstexprMap. Covers integers,
+// enums and strings, the latter through Hashing::Chars since Bytes cannot
+// run in a constant expression.
+template <typename T, typename = void>
+struct ConstexprHash
+{
+    static_assert(std::is_integral_v<T> || std::is_enum_v<T>,
+                  "ConstexprHash covers integers, enums and strings");
+
+    constexpr size_t operator()(const T& value) const
+    {
+        return static_cast<size_t>(Util::Hashing::Mix(static_cast<uint64_t>(value)));
+    }
+};
+
+template <typename T>
+struct ConstexprHash<T, std::enable_if_t<IsStringLike<T>>>
+{
+    using is_transparent = void;
+
+    constexpr size_t operator()(const std::string_view value) const
+    {
+        return static_cast<size_t>(Util::Hashing::Chars(value));
+    }
+};
+}  // namespace Moon
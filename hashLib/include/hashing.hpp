@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Moon::Util
+{
+
+// Non-cryptographic hash primitives built on the 64x64->128 bit multiply
+// and xor fold of wyhash. Results are not stable across platforms of
+// different endianness, nothing here is meant to be persisted.
+class Hashing
+{
+   public:
+    static constexpr uint64_t SECRET[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                                           0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+    // Xor of the two halves of the full product
+    static constexpr uint64_t MultiplyFold(const uint64_t a, const uint64_t b)
+    {
+        const __uint128_t product = static_cast<__uint128_t>(a) * b;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+    }
+
+    // Every input bit flips every output bit with probability close to one
+    // half. A single fold does not get there, the low input bits barely
+    // reach the low output bits.
+    static constexpr uint64_t Mix(const uint64_t value)
+    {
+        const uint64_t folded = MultiplyFold(value ^ SECRET[0], SECRET[1]);
+        return MultiplyFold(folded ^ SECRET[2], SECRET[3]);
+    }
+
+    // 2^64 divided by the golden ratio, odd so the multiply is a bijection
+    static constexpr uint64_t FIBONACCI_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    // Fibonacci hashing. The high bits of the product depend on every bit of
+    // hash, so tables and shards take their index from the top of it.
+    static constexpr uint64_t FibonacciMultiply(const uint64_t hash)
+    {
+        return hash * FIBONACCI_MULTIPLIER;
+    }
+
+    // Order dependent, Combine(Combine(s, a), b) differs from Combine(Combine(s, b), a)
+    static constexpr uint64_t Combine(const uint64_t seed, const uint64_t hash)
+    {
+        return MultiplyFold(seed ^ SECRET[0], hash ^ SECRET[1]);
+    }
+
+    // wyhash over size bytes. Inputs up to 16 bytes take two overlapping
+    // loads and a couple of multiplies, longer ones run three independent
+    // multiply chains over 48 byte blocks.
+    static uint64_t Bytes(const void* data, const size_t size, const uint64_t seed = 0)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        uint64_t state = seed ^ MultiplyFold(seed ^ SECRET[0], SECRET[1]);
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                const size_t offset = (size >> 3) << 2;
+                a = (Read4(bytes) << 32) | Read4(bytes + offset);
+                b = (Read4(bytes + size - 4) << 32) | Read4(bytes + size - 4 - offset);
+            }
+            else if (size > 0)
+            {
+                a = Read3(bytes, size);
+            }
+        }
+        else
+        {
+            size_t remaining = size;
+            if (remaining >= 48)
+            {
+                uint64_t state1 = state;
+                uint64_t state2 = state;
+                do
+                {
+                    state = MultiplyFold(Read8(bytes) ^ SECRET[1], Read8(bytes + 8) ^ state);
+                    state1 = MultiplyFold(Read8(bytes + 16) ^ SECRET[2], Read8(bytes + 24) ^ state1);
+                    state2 = MultiplyFold(Read8(bytes + 32) ^ SECRET[3], Read8(bytes + 40) ^ state2);
+                    bytes += 48;
+                    remaining -= 48;
+                } while (remaining >= 48);
+                state ^= state1 ^ state2;
+            }
+            while (remaining > 16)
+            {
+                state = MultiplyFold(Read8(bytes) ^ SECRET[1], Read8(bytes + 8) ^ state);
+                bytes += 16;
+                remaining -= 16;
+            }
+            // The last 16 bytes, overlapping the block before if needed
+            a = Read8(bytes + remaining - 16);
+            b = Read8(bytes + remaining - 8);
+        }
+
+        const __uint128_t product = static_cast<__uint128_t>(a ^ SECRET[1]) * (b ^ state);
+        a = static_cast<uint64_t>(product);
+        b = static_cast<uint64_t>(product >> 64);
+        return MultiplyFold(a ^ SECRET[0] ^ size, b ^ SECRET[1]);
+    }
+
+    // Usable in constant expressions, where Bytes is not. One multiply per 8
+    // characters, it is meant for short keys such as identifiers and names.
+    static constexpr uint64_t Chars(const std::string_view chars, const uint64_t seed = 0)
+    {
+        uint64_t state = seed ^ SECRET[0];
+        size_t offset = 0;
+        for (; offset + 8 <= chars.size(); offset += 8)
+        {
+            state = MultiplyFold(ReadChars(chars, offset, 8) ^ SECRET[1], state ^ SECRET[2]);
+        }
+        const uint64_t tail = ReadChars(chars, offset, chars.size() - offset);
+        state = MultiplyFold(tail ^ SECRET[1], state ^ SECRET[2]);
+        return MultiplyFold(state ^ chars.size(), SECRET[3]);
+    }
+
+   private:
+    // Little endian word of count <= 8 characters. Outside constant
+    // evaluation the same word is built from at most two loads.
+    static constexpr uint64_t ReadChars(const std::string_view chars, const size_t offset,
+                                        const size_t count)
+    {
+        if (!__builtin_is_constant_evaluated())
+        {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(chars.data() + offset);
+            if (count >= 4)
+            {
+                return Read4(bytes) | ((Read4(bytes + count - 4) >> (8 * (8 - count))) << 32);
+            }
+            if (count == 0)
+            {
+                return 0;
+            }
+        }
+        uint64_t value = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(chars[offset + i])) << (8 * i);
+        }
+        return value;
+    }
+
+    static uint64_t Read8(const uint8_t* bytes)
+    {
+        uint64_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    static uint64_t Read4(const uint8_t* bytes)
+    {
+        uint32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    // First, middle and last byte of 1 to 3 bytes
+    static uint64_t Read3(const uint8_t* bytes, const size_t size)
+    {
+        return (static_cast<uint64_t>(bytes[0]) << 16) |
+               (static_cast<uint64_t>(bytes[size >> 1]) << 8) | bytes[size - 1];
+    }
+};
+}  // namespace Moon::Util
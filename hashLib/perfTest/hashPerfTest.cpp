@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <HashLib/hash.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Reference cycles, the time stamp counter ticks at the nominal frequency
+// whatever the current clock
+static uint64_t ReadCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void SizeArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(4)->Arg(8)->Arg(16)->Arg(32)->Arg(64)->Arg(256)->Arg(4096)->Arg(65536);
+}
+
+struct MoonBytesHasher
+{
+    uint64_t operator()(const std::string_view bytes) const
+    {
+        return Moon::Util::Hashing::Bytes(bytes.data(), bytes.size());
+    }
+};
+
+struct StdBytesHasher
+{
+    uint64_t operator()(const std::string_view bytes) const
+    {
+        return std::hash<std::string_view>()(bytes);
+    }
+};
+
+// Each input depends on the previous hash, so the benchmark measures latency
+// the way a lookup sees it instead of overlapping independent hashes
+template <typename BytesHasher>
+static void BM_HashBytes(benchmark::State& state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<char> buffer(size + 1, 'x');
+    const BytesHasher hasher;
+    uint64_t hash = 0;
+    const uint64_t startCycles = ReadCycles();
+    for (auto _ : state)
+    {
+        hash = hasher(std::string_view(buffer.data() + (hash & 1), size));
+        benchmark::DoNotOptimize(hash);
+    }
+    const uint64_t cycles = ReadCycles() - startCycles;
+    const double bytes = static_cast<double>(state.iterations()) * static_cast<double>(size);
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    if (cycles > 0)
+    {
+        state.counters["bytesPerCycle"] = bytes / static_cast<double>(cycles);
+    }
+}
+
+template <typename IntegerHasher>
+static void BM_HashInteger(benchmark::State& state)
+{
+    const IntegerHasher hasher;
+    uint64_t hash = 0;
+    for (auto _ : state)
+    {
+        hash = hasher(hash + 1);
+        benchmark::DoNotOptimize(hash);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_HashBytes, MoonBytesHasher)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_HashBytes, StdBytesHasher)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_HashInteger, Moon::Hash<uint64_t>);
+BENCHMARK_TEMPLATE(BM_HashInteger, std::hash<uint64_t>);
+
+BENCHMARK_MAIN();
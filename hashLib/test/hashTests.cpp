@@ -0,0 +1,318 @@
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <HashLib/hash.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Moon::Test
+{
+using Hashing = Moon::Util::Hashing;
+
+struct Point
+{
+    int mX;
+    int mY;
+
+    auto HashFields() const
+    {
+        return std::tie(mX, mY);
+    }
+};
+
+// Hashable only through its std::hash specialisation
+struct Ticket
+{
+    int mNumber;
+
+    bool operator==(const Ticket& other) const
+    {
+        return mNumber == other.mNumber;
+    }
+};
+}  // namespace Moon::Test
+
+template <>
+struct std::hash<Moon::Test::Ticket>
+{
+    size_t operator()(const Moon::Test::Ticket& ticket) const
+    {
+        return static_cast<size_t>(ticket.mNumber);
+    }
+};
+
+namespace Moon::Test
+{
+
+class HashFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+
+    // Largest deviation from one half of the probability that flipping an
+    // input bit flips an output bit, over all input and output bit pairs
+    template <typename Function>
+    static double WorstAvalancheBias(Function&& function, const size_t inputBytes)
+    {
+        constexpr int SAMPLES = 2000;
+        std::mt19937_64 rng(7);
+        std::vector<uint8_t> input(inputBytes);
+        std::vector<std::array<int, 64>> flips(inputBytes * 8, std::array<int, 64>{});
+        for (int sample = 0; sample < SAMPLES; ++sample)
+        {
+            for (auto& byte : input)
+            {
+                byte = static_cast<uint8_t>(rng());
+            }
+            const uint64_t hash = function(input.data());
+            for (size_t bit = 0; bit < inputBytes * 8; ++bit)
+            {
+                input[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+                const uint64_t difference = hash ^ function(input.data());
+                input[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+                for (int outputBit = 0; outputBit < 64; ++outputBit)
+                {
+                    flips[bit][outputBit] += static_cast<int>((difference >> outputBit) & 1);
+                }
+            }
+        }
+
+        double worst = 0;
+        for (const auto& row : flips)
+        {
+            for (const int count : row)
+            {
+                worst = std::max(worst, std::fabs(count / static_cast<double>(SAMPLES) - 0.5));
+            }
+        }
+        return worst;
+    }
+
+    template <typename Key>
+    struct Entry
+    {
+        Key mKey;
+        int mValue;
+    };
+
+    template <typename Key>
+    struct EntryHasher
+    {
+        size_t operator()(const Entry<Key>& entry) const
+        {
+            return Hash<Key>()(entry.mKey);
+        }
+    };
+
+    // Mean number of slots a successful lookup inspects, recorded as a test
+    // property, next to what uniformly random hashes would give at the same load
+    template <typename Key, typename SizingPolicy>
+    void ExpectUniformProbeLengths(const std::vector<Key>& keys, const std::string& name)
+    {
+        OpenAddressingCollisionHandler<Entry<Key>, EntryHasher<Key>, HeapAllocator<Entry<Key>>,
+                                       LinearProbing, SizingPolicy>
+            handler;
+        // Linear probing at a high load magnifies any clustering of the hashes
+        handler.SetMaxLoadFactor(0.9);
+        for (const auto& key : keys)
+        {
+            handler.Insert(Hash<Key>()(key), Entry<Key>{key, 0});
+        }
+        ASSERT_EQ(handler.Size(), keys.size());
+
+        double total = 0;
+        for (const auto& key : keys)
+        {
+            total += static_cast<double>(handler.ProbeLength(Hash<Key>()(key), key));
+        }
+        const double mean = total / static_cast<double>(keys.size());
+        // Knuth's expected successful search length for linear probing
+        const double load = static_cast<double>(handler.Size()) / handler.Capacity();
+        const double expected = 0.5 * (1 + 1 / (1 - load));
+        RecordProperty(name + "MeanProbeLength", std::to_string(mean));
+        RecordProperty(name + "ExpectedProbeLength", std::to_string(expected));
+        EXPECT_LT(mean, expected * 1.15) << name;
+    }
+};
+
+TEST_F(HashFixture, WHEN_bytes_are_hashed_THEN_every_length_and_seed_gives_a_distinct_hash)
+{
+    std::vector<uint8_t> buffer(300, 0);
+    std::set<uint64_t> hashes;
+    for (size_t size = 0; size <= buffer.size(); ++size)
+    {
+        EXPECT_EQ(Hashing::Bytes(buffer.data(), size), Hashing::Bytes(buffer.data(), size));
+        EXPECT_TRUE(hashes.insert(Hashing::Bytes(buffer.data(), size)).second) << size;
+        EXPECT_TRUE(hashes.insert(Hashing::Bytes(buffer.data(), size, 1)).second) << size;
+    }
+    // Every single byte change of a 100 byte input
+    for (size_t i = 0; i < 100; ++i)
+    {
+        buffer[i] = 1;
+        EXPECT_TRUE(hashes.insert(Hashing::Bytes(buffer.data(), 100)).second) << i;
+        buffer[i] = 0;
+    }
+}
+
+TEST_F(HashFixture, WHEN_an_input_bit_flips_THEN_about_half_the_output_bits_flip)
+{
+    // Sampling noise alone reaches about 0.06 across the thousands of bit
+    // pairs, a single multiply fold is off by 0.48
+    const auto mix = [](const uint8_t* input) {
+        uint64_t value;
+        std::memcpy(&value, input, sizeof(value));
+        return Hashing::Mix(value);
+    };
+    EXPECT_LT(WorstAvalancheBias(mix, 8), 0.08);
+
+    // One input size per branch of the byte hasher
+    for (const size_t size : {3, 8, 16, 40, 64})
+    {
+        const auto bytes = [size](const uint8_t* input) { return Hashing::Bytes(input, size); };
+        EXPECT_LT(WorstAvalancheBias(bytes, size), 0.08) << size;
+    }
+}
+
+TEST_F(HashFixture, WHEN_composite_keys_are_hashed_THEN_members_and_their_order_count)
+{
+    const Hash<std::pair<int, int>> pairHash;
+    const Hash<std::tuple<int, int>> tupleHash;
+    const Hash<std::tuple<int>> singleHash;
+    EXPECT_EQ(pairHash({1, 2}), pairHash({1, 2}));
+    EXPECT_NE(pairHash({1, 2}), pairHash({2, 1}));
+    EXPECT_EQ(tupleHash({1, 2}), pairHash({1, 2}));
+    EXPECT_NE(singleHash({1}), tupleHash({1, 0}));
+
+    // A struct hashes like the tuple of its fields
+    const Hash<Point> pointHash;
+    EXPECT_EQ(pointHash({3, 4}), tupleHash({3, 4}));
+    EXPECT_NE(pointHash({3, 4}), pointHash({4, 3}));
+
+    const Hash<std::pair<std::string, Point>> nestedHash;
+    EXPECT_EQ(nestedHash({"a", {1, 2}}), nestedHash({std::string("a"), {1, 2}}));
+    EXPECT_NE(nestedHash({"a", {1, 2}}), nestedHash({"b", {1, 2}}));
+}
+
+TEST_F(HashFixture, WHEN_equal_values_of_different_types_are_hashed_THEN_hashes_agree)
+{
+    const std::string text = "moon";
+    EXPECT_EQ(Hash<std::string>()(text), Hash<std::string>()(std::string_view(text)));
+    EXPECT_EQ(Hash<std::string>()(text), Hash<std::string>()("moon"));
+    EXPECT_TRUE(std::is_void_v<Hash<std::string>::is_transparent>);
+
+    EXPECT_EQ(Hash<double>()(0.0), Hash<double>()(-0.0));
+    EXPECT_EQ(Hash<long double>()(0.0L), Hash<long double>()(-0.0L));
+    EXPECT_NE(Hash<int>()(0), Hash<int>()(1));
+    // The fallback mixes std::hash, so the identity does not leak through
+    EXPECT_NE(Hash<Ticket>()({5}), 5);
+    EXPECT_EQ(Hash<Ticket>()({5}), Hash<Ticket>()({5}));
+}
+
+// Leaves pattern in the stack the next call builds its locals on
+__attribute__((noinline)) void FillStack(const unsigned char pattern)
+{
+    volatile unsigned char bytes[1024];
+    for (auto& byte : bytes)
+    {
+        byte = pattern;
+    }
+}
+
+__attribute__((noinline)) uint64_t HashOverStack(const long double value,
+                                                  const unsigned char pattern)
+{
+    FillStack(pattern);
+    return Hash<long double>()(value);
+}
+
+TEST_F(HashFixture, WHEN_long_double_padding_differs_THEN_hashes_agree)
+{
+    // A long double copy only writes the bytes of the value, the padding
+    // keeps whatever the stack held
+    const long double value = 1.0L / 3.0L;
+    EXPECT_EQ(HashOverStack(value, 0x00), HashOverStack(value, 0xff));
+    EXPECT_EQ(HashOverStack(value, 0x5a), HashOverStack(value, 0xa5));
+    EXPECT_NE(HashOverStack(value, 0x00), HashOverStack(2.0L / 3.0L, 0x00));
+    EXPECT_LE(SignificantBytes<long double>(), sizeof(long double));
+}
+
+TEST_F(HashFixture, WHEN_chars_are_hashed_at_compile_time_THEN_run_time_hashes_agree)
+{
+    static_assert(ConstexprHash<std::string_view>()("moon") == Hashing::Chars("moon"));
+    static_assert(ConstexprHash<int>()(7) == Hashing::Mix(7));
+
+    // Run time hashing reads words where constant evaluation reads bytes,
+    // every tail length has to come out the same
+    static constexpr std::string_view LITERAL = "abcdefghijklmnopqrstu";
+    static constexpr auto COMPILE_TIME_HASHES = [] {
+        std::array<uint64_t, LITERAL.size() + 1> hashes{};
+        for (size_t size = 0; size <= LITERAL.size(); ++size)
+        {
+            hashes[size] = Hashing::Chars(LITERAL.substr(0, size));
+        }
+        return hashes;
+    }();
+    const std::string literal(LITERAL);
+    for (size_t size = 0; size <= literal.size(); ++size)
+    {
+        EXPECT_EQ(Hashing::Chars(literal.substr(0, size)), COMPILE_TIME_HASHES[size]) << size;
+    }
+
+    const std::string text(40, 'x');
+    std::set<uint64_t> hashes;
+    for (size_t size = 0; size <= text.size(); ++size)
+    {
+        const std::string prefix = text.substr(0, size);
+        EXPECT_EQ(ConstexprHash<std::string>()(prefix), Hashing::Chars(prefix));
+        EXPECT_TRUE(hashes.insert(Hashing::Chars(prefix)).second) << size;
+    }
+    // Every single character change of a 20 character input
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::string changed = text.substr(0, 20);
+        changed[i] = 'y';
+        EXPECT_TRUE(hashes.insert(Hashing::Chars(changed)).second) << i;
+    }
+}
+
+TEST_F(HashFixture, WHEN_patterned_keys_fill_a_table_THEN_probe_lengths_match_random_hashing)
+{
+    // 85% of a 16K slot table
+    constexpr size_t COUNT = 14000;
+    std::vector<uint64_t> sequential(COUNT);
+    std::vector<uint64_t> aligned(COUNT);
+    std::vector<std::string> strings(COUNT);
+    std::vector<std::pair<int, int>> grid(COUNT);
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        sequential[i] = i;
+        aligned[i] = i << 20;
+        strings[i] = "user:" + std::to_string(i);
+        grid[i] = {static_cast<int>(i % 128), static_cast<int>(i / 128)};
+    }
+
+    ExpectUniformProbeLengths<uint64_t, PowerOfTwoSizing>(sequential, "sequential");
+    ExpectUniformProbeLengths<uint64_t, PrimeSizing>(sequential, "sequentialPrime");
+    ExpectUniformProbeLengths<uint64_t, PowerOfTwoSizing>(aligned, "aligned");
+    ExpectUniformProbeLengths<uint64_t, PrimeSizing>(aligned, "alignedPrime");
+    ExpectUniformProbeLengths<std::string, PowerOfTwoSizing>(strings, "strings");
+    ExpectUniformProbeLengths<std::string, PrimeSizing>(strings, "stringsPrime");
+    ExpectUniformProbeLengths<std::pair<int, int>, PowerOfTwoSizing>(grid, "grid");
+    ExpectUniformProbeLengths<std::pair<int, int>, PrimeSizing>(grid, "gridPrime");
+}
+}  // namespace Moon::Test
@@ -0,0 +1 @@
+#include <MapLib/concurrentHashMap.hpp>
@@ -0,0 +1 @@
+#include <MapLib/constexprMap.hpp>
@@ -0,0 +1 @@
+#include <MapLib/denseHashMap.hpp>
@@ -0,0 +1 @@
+#include <MapLib/frozenHashMap.hpp>
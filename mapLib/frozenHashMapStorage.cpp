@@ -0,0 +1,131 @@
+#include <MapLib/frozenHashMapStorage.hpp>
+#include <MemoryLib/pageAllocator.hpp>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace Moon
+{
+
+FrozenHashMapStorage::FrozenHashMapStorage() : mData(nullptr), mSize(0), mIsMapped(false)
+{
+}
+
+FrozenHashMapStorage::FrozenHashMapStorage(const size_t size)
+    : mData(static_cast<std::byte*>(::operator new(size, std::align_val_t(ALIGNMENT)))),
+      mSize(size),
+      mIsMapped(false)
+{
+    std::memset(mData, 0, mSize);
+}
+
+FrozenHashMapStorage::FrozenHashMapStorage(const std::string& path)
+    : mData(nullptr), mSize(0), mIsMapped(true)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("FrozenHashMapStorage(): cannot open " + path);
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+        throw std::runtime_error("FrozenHashMapStorage(): cannot map " + path);
+    }
+    try
+    {
+        mData = const_cast<std::byte*>(
+            PageAllocator::MapFileReadOnly(fd, static_cast<size_t>(fileStat.st_size)));
+    }
+    catch (const std::bad_alloc&)
+    {
+        close(fd);
+        throw std::runtime_error("FrozenHashMapStorage(): cannot map " + path);
+    }
+    mSize = static_cast<size_t>(fileStat.st_size);
+    // The mapping stays valid without the descriptor
+    close(fd);
+}
+
+FrozenHashMapStorage::FrozenHashMapStorage(FrozenHashMapStorage&& other) noexcept
+    : mData(std::exchange(other.mData, nullptr)),
+      mSize(std::exchange(other.mSize, 0)),
+      mIsMapped(std::exchange(other.mIsMapped, false))
+{
+}
+
+FrozenHashMapStorage& FrozenHashMapStorage::operator=(FrozenHashMapStorage&& other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        mData = std::exchange(other.mData, nullptr);
+        mSize = std::exchange(other.mSize, 0);
+        mIsMapped = std::exchange(other.mIsMapped, false);
+    }
+    return *this;
+}
+
+FrozenHashMapStorage::~FrozenHashMapStorage()
+{
+    Release();
+}
+
+void FrozenHashMapStorage::Save(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(mData), static_cast<std::streamsize>(mSize));
+    file.close();
+    if (!file)
+    {
+        throw std::runtime_error("FrozenHashMapStorage(): cannot write " + path);
+    }
+}
+
+const std::byte* FrozenHashMapStorage::GetData() const
+{
+    return mData;
+}
+
+std::byte* FrozenHashMapStorage::GetMutableData()
+{
+    return mIsMapped ? nullptr : mData;
+}
+
+size_t FrozenHashMapStorage::GetSize() const
+{
+    return mSize;
+}
+
+bool FrozenHashMapStorage::IsMapped() const
+{
+    return mIsMapped;
+}
+
+void FrozenHashMapStorage::Release()
+{
+    if (mData == nullptr)
+    {
+        return;
+    }
+    if (mIsMapped)
+    {
+        PageAllocator::Unmap(mData, mSize);
+    }
+    else
+    {
+        ::operator delete(mData, std::align_val_t(ALIGNMENT));
+    }
+    mData = nullptr;
+    mSize = 0;
+}
+}  // namespace Moon
@@ -0,0 +1 @@
+#include <MapLib/hashMap.hpp>
@@ -1 +0,0 @@
-#include <MapLib/hashmap.hpp>
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <HashLib/hash.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace Moon
+{
+
+// Hash map shared between threads. Keys are spread over a power of two number
+// of shards, each an open addressing table with its own write mutex and
+// sequence counter. Writers hold the mutex and keep the counter odd while
+// they change the table. Readers take no lock and store to no shared memory,
+// they copy their result and retry until the counter read before and after
+// it is the same even value.
+//
+// Since a reader may copy a slot while a writer changes it, Key and Value
+// must be trivially copyable. A resize publishes a grown copy of the table
+// instead of reallocating the one readers may be probing. Replaced tables are
+// kept until the map is destroyed. The shards use Robin Hood probing, which
+// leaves no tombstones, so a table is only replaced to double and the
+// replaced ones add up to less than the live one.
+template <typename Key, typename Value, typename Hasher = Hash<Key>>
+class ConcurrentHashMap
+{
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                  "lock-free readers copy keys and values a writer may be changing");
+
+   public:
+    struct KeyValuePair
+    {
+        Key mKey;
+        Value mValue;
+    };
+
+    struct KeyValuePairHasher
+    {
+        size_t operator()(const KeyValuePair& keyValuePair) const
+        {
+            return mHasher(keyValuePair.mKey);
+        }
+
+        Hasher mHasher;
+    };
+
+    using CollisionHandlerType =
+        OpenAddressingCollisionHandler<KeyValuePair, KeyValuePairHasher,
+                                       HeapAllocator<KeyValuePair>, RobinHoodProbing>;
+
+    static constexpr size_t DEFAULT_SHARD_COUNT = 64;
+
+    // shardCount is rounded up to a power of two
+    explicit ConcurrentHashMap(const size_t shardCount = DEFAULT_SHARD_COUNT,
+                               const Hasher& hasher = Hasher());
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+    ~ConcurrentHashMap() = default;
+
+    void Insert(const Key& key, const Value& value);
+    // Returns false if the key was not present
+    bool Delete(const Key& key);
+    // Calls function with the value of key, value-initialised first if the
+    // key was absent. Readers of the shard spin while it runs, keep it short.
+    // If function throws, the key keeps whatever function left in its value.
+    template <typename Function>
+    void Upsert(const Key& key, Function&& function);
+    void Clear();
+
+    // Copies the value of key into value, returns false if the key is absent
+    bool Find(const Key& key, Value& value) const;
+    bool Contains(const Key& key) const;
+
+    // Shards are counted one after another, concurrent writes may or may not
+    // be included
+    size_t Size() const;
+    size_t GetShardCount() const noexcept;
+
+   private:
+    // Failed read attempts before a reader yields its time slice
+    static constexpr size_t MAX_SPINS = 64;
+
+    struct alignas(64) Shard
+    {
+        // Odd while a writer changes the table
+        std::atomic<uint64_t> mSequence{0};
+        std::atomic<CollisionHandlerType*> mTable{nullptr};
+        std::mutex mWriteMutex;
+        // Every table the shard has used, the last one is mTable. Readers may
+        // still be probing the others.
+        std::vector<std::unique_ptr<CollisionHandlerType>> mTables;
+    };
+
+    size_t HashOf(const Key& key) const;
+    Shard& GetShard(const size_t hash) const;
+
+    // Retries reader on a consistent view of the shard table
+    template <typename Reader>
+    static void ReadShard(const Shard& shard, Reader&& reader);
+    // Runs writer on the shard table with the sequence counter odd, the
+    // caller holds the shard mutex
+    template <typename Writer>
+    static void WriteShard(Shard& shard, Writer&& writer);
+    // Publishes a grown copy of the shard table if inserting into it would
+    // reallocate it, the caller holds the shard mutex
+    CollisionHandlerType& ReserveInsert(Shard& shard);
+
+   private:
+    Hasher mHasher;
+    size_t mShardMask;
+    std::unique_ptr<Shard[]> mShards;
+};
+
+}  // namespace Moon
+
+#include <MapLib/concurrentHashMap.ipp>
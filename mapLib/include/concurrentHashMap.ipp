@@ -0,0 +1,218 @@
+#pragma once
+
+#include <CommonLib/math.hpp>
+#include <HashLib/hashing.hpp>
+#include <MapLib/concurrentHashMap.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename Key, typename Value, typename Hasher>
+ConcurrentHashMap<Key, Value, Hasher>::ConcurrentHashMap(const size_t shardCount,
+                                                         const Hasher& hasher)
+    : mHasher(hasher),
+      mShardMask(Util::Math::NextPowerOfTwo(shardCount) - 1),
+      mShards(std::make_unique<Shard[]>(mShardMask + 1))
+{
+    for (size_t i = 0; i <= mShardMask; ++i)
+    {
+        // Starts without slots, the first insert publishes a real table
+        auto& shard = mShards[i];
+        shard.mTables.push_back(
+            std::make_unique<CollisionHandlerType>(0, KeyValuePairHasher{mHasher}));
+        shard.mTable.store(shard.mTables.back().get(), std::memory_order_relaxed);
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+void ConcurrentHashMap<Key, Value, Hasher>::Insert(const Key& key, const Value& value)
+{
+    Upsert(key, [&value](Value& stored) { stored = value; });
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool ConcurrentHashMap<Key, Value, Hasher>::Delete(const Key& key)
+{
+    const size_t hash = HashOf(key);
+    auto& shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mWriteMutex);
+    auto& table = *shard.mTable.load(std::memory_order_relaxed);
+    // A miss leaves the readers of the shard undisturbed
+    if (std::as_const(table).Find(hash, key) == table.End())
+    {
+        return false;
+    }
+    WriteShard(shard, [&](CollisionHandlerType& writable) { writable.Delete(hash, key); });
+    return true;
+}
+
+template <typename Key, typename Value, typename Hasher>
+template <typename Function>
+void ConcurrentHashMap<Key, Value, Hasher>::Upsert(const Key& key, Function&& function)
+{
+    const size_t hash = HashOf(key);
+    auto& shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mWriteMutex);
+    auto& table = *shard.mTable.load(std::memory_order_relaxed);
+    // Only an absent key may need a grown table
+    const auto it = std::as_const(table).Find(hash, key);
+    if (it != table.End())
+    {
+        WriteShard(shard, [&](CollisionHandlerType&) { function(it->mValue); });
+        return;
+    }
+    ReserveInsert(shard);
+    WriteShard(shard, [&](CollisionHandlerType& writable) {
+        function(writable.LookupOrDefaultConstruct(hash, key).mValue);
+    });
+}
+
+template <typename Key, typename Value, typename Hasher>
+void ConcurrentHashMap<Key, Value, Hasher>::Clear()
+{
+    for (size_t i = 0; i <= mShardMask; ++i)
+    {
+        auto& shard = mShards[i];
+        std::lock_guard<std::mutex> lock(shard.mWriteMutex);
+        WriteShard(shard, [](CollisionHandlerType& table) { table.Clear(); });
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool ConcurrentHashMap<Key, Value, Hasher>::Find(const Key& key, Value& value) const
+{
+    const size_t hash = HashOf(key);
+    bool found = false;
+    ReadShard(GetShard(hash), [&](const CollisionHandlerType& table) {
+        const auto it = table.Find(hash, key);
+        found = it != table.End();
+        if (found)
+        {
+            value = it->mValue;
+        }
+    });
+    return found;
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool ConcurrentHashMap<Key, Value, Hasher>::Contains(const Key& key) const
+{
+    Value value{};
+    return Find(key, value);
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t ConcurrentHashMap<Key, Value, Hasher>::Size() const
+{
+    size_t size = 0;
+    for (size_t i = 0; i <= mShardMask; ++i)
+    {
+        size_t shardSize = 0;
+        ReadShard(mShards[i],
+                  [&shardSize](const CollisionHandlerType& table) { shardSize = table.Size(); });
+        size += shardSize;
+    }
+    return size;
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t ConcurrentHashMap<Key, Value, Hasher>::GetShardCount() const noexcept
+{
+    return mShardMask + 1;
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t ConcurrentHashMap<Key, Value, Hasher>::HashOf(const Key& key) const
+{
+    return mHasher(key);
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename ConcurrentHashMap<Key, Value, Hasher>::Shard&
+ConcurrentHashMap<Key, Value, Hasher>::GetShard(const size_t hash) const
+{
+    // The tables take their home slot from the top bits of the same multiply,
+    // the shard comes from the middle so the two stay independent
+    const uint64_t mixed = Util::Hashing::FibonacciMultiply(hash);
+    return mShards[(mixed >> 32) & mShardMask];
+}
+
+template <typename Key, typename Value, typename Hasher>
+template <typename Reader>
+void ConcurrentHashMap<Key, Value, Hasher>::ReadShard(const Shard& shard, Reader&& reader)
+{
+    for (size_t attempt = 1;; ++attempt)
+    {
+        // A writer that lost its time slice keeps the counter odd, spinning
+        // on would only delay it further
+        if (attempt % MAX_SPINS == 0)
+        {
+            std::this_thread::yield();
+        }
+        const uint64_t sequence = shard.mSequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+        {
+            continue;
+        }
+        // The table may be changing under the reader, the result only counts
+        // if no write started in the meantime
+        reader(std::as_const(*shard.mTable.load(std::memory_order_acquire)));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (shard.mSequence.load(std::memory_order_relaxed) == sequence)
+        {
+            return;
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+template <typename Writer>
+void ConcurrentHashMap<Key, Value, Hasher>::WriteShard(Shard& shard, Writer&& writer)
+{
+    // Puts the counter back to even also when writer throws, an odd counter
+    // would stall every reader of the shard
+    struct SequenceGuard
+    {
+        ~SequenceGuard()
+        {
+            mSequence.store(mStart + 2, std::memory_order_release);
+        }
+
+        std::atomic<uint64_t>& mSequence;
+        const uint64_t mStart;
+    };
+
+    const uint64_t sequence = shard.mSequence.load(std::memory_order_relaxed);
+    shard.mSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    const SequenceGuard guard{shard.mSequence, sequence};
+    writer(*shard.mTable.load(std::memory_order_relaxed));
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename ConcurrentHashMap<Key, Value, Hasher>::CollisionHandlerType&
+ConcurrentHashMap<Key, Value, Hasher>::ReserveInsert(Shard& shard)
+{
+    auto& table = *shard.mTable.load(std::memory_order_relaxed);
+    if (!table.InsertWouldRehash())
+    {
+        return table;
+    }
+
+    // Readers keep using the old table until the new one is published. The
+    // handler rounds the first capacity up to its minimum.
+    auto grown = std::make_unique<CollisionHandlerType>(std::max<size_t>(table.Capacity() * 2, 1),
+                                                        KeyValuePairHasher{mHasher});
+    for (const auto& keyValuePair : table)
+    {
+        grown->Insert(HashOf(keyValuePair.mKey), keyValuePair);
+    }
+    shard.mTable.store(grown.get(), std::memory_order_release);
+    shard.mTables.push_back(std::move(grown));
+    return *shard.mTables.back();
+}
+}  // namespace Moon
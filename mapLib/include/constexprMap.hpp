@@ -0,0 +1,66 @@
+#pragma once
+
+#include <HashLib/hash.hpp>
+#include <MapLib/perfectHash.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Moon
+{
+
+// Map over a fixed set of keys, laid out at compile time with the
+// PerfectHash scheme of FrozenHashMap. Declared constexpr, the seeds, keys
+// and values are constant data and cost nothing at static initialisation.
+// A lookup hashes the key, reads one seed and compares one key, with no
+// probing loop.
+//
+//   static constexpr auto COLORS = MakeConstexprMap<std::string_view, int>(
+//       {{"red", 0xff0000}, {"green", 0x00ff00}, {"blue", 0x0000ff}});
+//
+// Key and Value must be literal types that are default constructible and
+// assignable in constant expressions, e.g. integers, enums, std::string_view
+// and function pointers. The compile-time search is meant for tables of up
+// to a few hundred keys. A duplicate key fails the compilation of a constexpr
+// map, and throws std::invalid_argument from a map built at run time. Two
+// distinct keys with the same hash fail the same way, with std::runtime_error
+// at run time, since no seed can place them apart.
+template <typename Key, typename Value, size_t N, typename Hasher = ConstexprHash<Key>>
+class ConstexprMap
+{
+    static_assert(N > 0, "a ConstexprMap needs at least one key");
+
+   public:
+    using EntryType = std::pair<Key, Value>;
+
+    constexpr explicit ConstexprMap(const EntryType (&entries)[N], const Hasher& hasher = Hasher());
+
+    // Returns nullptr if the key is absent
+    constexpr const Value* Find(const Key& key) const;
+    constexpr bool Contains(const Key& key) const;
+
+    static constexpr size_t Size() noexcept;
+    static constexpr bool Empty() noexcept;
+
+   private:
+    static constexpr size_t BUCKET_COUNT = PerfectHash::GetBucketCount(N);
+
+    constexpr void Build(const EntryType (&entries)[N]);
+    // The only slot key can be in
+    constexpr size_t GetSlot(const Key& key) const;
+
+   private:
+    Hasher mHasher;
+    std::array<uint32_t, BUCKET_COUNT> mSeeds;
+    std::array<Key, N> mKeys;
+    std::array<Value, N> mValues;
+};
+
+template <typename Key, typename Value, size_t N>
+constexpr ConstexprMap<Key, Value, N> MakeConstexprMap(const std::pair<Key, Value> (&entries)[N]);
+
+}  // namespace Moon
+
+#include <MapLib/constexprMap.ipp>
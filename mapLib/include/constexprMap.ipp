@@ -0,0 +1,152 @@
+#pragma once
+
+#include <MapLib/constexprMap.hpp>
+
+#include <limits>
+#include <stdexcept>
+
+namespace Moon
+{
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+constexpr ConstexprMap<Key, Value, N, Hasher>::ConstexprMap(const EntryType (&entries)[N],
+                                                            const Hasher& hasher)
+    : mHasher(hasher), mSeeds{}, mKeys{}, mValues{}
+{
+    Build(entries);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+constexpr const Value* ConstexprMap<Key, Value, N, Hasher>::Find(const Key& key) const
+{
+    const size_t slot = GetSlot(key);
+    return mKeys[slot] == key ? &mValues[slot] : nullptr;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+constexpr bool ConstexprMap<Key, Value, N, Hasher>::Contains(const Key& key) const
+{
+    return mKeys[GetSlot(key)] == key;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+constexpr size_t ConstexprMap<Key, Value, N, Hasher>::Size() noexcept
+{
+    return N;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+constexpr bool ConstexprMap<Key, Value, N, Hasher>::Empty() noexcept
+{
+    return false;
+}
+
+// Same search as FrozenHashMap::Build, on fixed size arrays and with
+// insertion sort since std::sort is not constexpr before C++20
+template <typename Key, typename Value, size_t N, typename Hasher>
+constexpr void ConstexprMap<Key, Value, N, Hasher>::Build(const EntryType (&entries)[N])
+{
+    std::array<uint64_t, N> hashes{};
+    std::array<size_t, N> buckets{};
+    // Entry indexes grouped by bucket, bucket b owns [bucketStarts[b], bucketStarts[b + 1])
+    std::array<size_t, BUCKET_COUNT + 1> bucketStarts{};
+    for (size_t i = 0; i < N; ++i)
+    {
+        hashes[i] = mHasher(entries[i].first);
+        buckets[i] = PerfectHash::GetBucket(hashes[i], BUCKET_COUNT);
+        ++bucketStarts[buckets[i] + 1];
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (entries[j].first == entries[i].first)
+            {
+                throw std::invalid_argument("ConstexprMap(): duplicate key");
+            }
+            // Keys with the same hash land on the same slot for every seed
+            if (hashes[j] == hashes[i])
+            {
+                throw std::runtime_error("ConstexprMap(): Hasher maps two keys to the same hash");
+            }
+        }
+    }
+    for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+        bucketStarts[bucket + 1] += bucketStarts[bucket];
+    }
+    std::array<size_t, N> members{};
+    std::array<size_t, BUCKET_COUNT> memberCounts{};
+    for (size_t i = 0; i < N; ++i)
+    {
+        members[bucketStarts[buckets[i]] + memberCounts[buckets[i]]++] = i;
+    }
+
+    // Largest buckets first, while most slots are still free
+    std::array<size_t, BUCKET_COUNT> order{};
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        size_t j = i;
+        while (j > 0 && memberCounts[order[j - 1]] < memberCounts[i])
+        {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = i;
+    }
+
+    std::array<bool, N> taken{};
+    std::array<size_t, N> bucketSlots{};
+    for (const size_t bucket : order)
+    {
+        const size_t first = bucketStarts[bucket];
+        const size_t count = memberCounts[bucket];
+        for (uint32_t seed = 0;; ++seed)
+        {
+            size_t placed = 0;
+            for (; placed < count; ++placed)
+            {
+                const size_t slot = PerfectHash::GetSlot(hashes[members[first + placed]], seed, N);
+                bool isFree = !taken[slot];
+                for (size_t k = 0; k < placed && isFree; ++k)
+                {
+                    isFree = bucketSlots[k] != slot;
+                }
+                if (!isFree)
+                {
+                    break;
+                }
+                bucketSlots[placed] = slot;
+            }
+            if (placed == count)
+            {
+                mSeeds[bucket] = seed;
+                break;
+            }
+            if (seed == std::numeric_limits<uint32_t>::max())
+            {
+                throw std::runtime_error("ConstexprMap(): no seed places a bucket");
+            }
+        }
+        for (size_t k = 0; k < count; ++k)
+        {
+            const auto& entry = entries[members[first + k]];
+            taken[bucketSlots[k]] = true;
+            mKeys[bucketSlots[k]] = entry.first;
+            mValues[bucketSlots[k]] = entry.second;
+        }
+    }
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+constexpr size_t ConstexprMap<Key, Value, N, Hasher>::GetSlot(const Key& key) const
+{
+    const uint64_t hash = mHasher(key);
+    const uint32_t seed = mSeeds[PerfectHash::GetBucket(hash, BUCKET_COUNT)];
+    return PerfectHash::GetSlot(hash, seed, N);
+}
+
+template <typename Key, typename Value, size_t N>
+constexpr ConstexprMap<Key, Value, N> MakeConstexprMap(const std::pair<Key, Value> (&entries)[N])
+{
+    return ConstexprMap<Key, Value, N>(entries);
+}
+
+}  // namespace Moon
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <HashLib/hash.hpp>
+#include <VectorLib/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Moon
+{
+
+// Map whose entries sit back to back in a Vector in insertion order, so that
+// iterating it is a walk over one array. The hash table next to it holds only
+// slots of a 32-bit entry index and 32 bits of the hash, 8 bytes each, probed
+// linearly and kept at most three quarters full. The stored hash bits are
+// compared before the key and let the table grow without rehashing a key.
+//
+// Delete moves the last entry into the hole it leaves, so the order is the
+// insertion order only until the first Delete. Every Insert and Delete may
+// invalidate iterators. A const map hands out ConstIteratorType, through which
+// nothing can be changed. Keys must not be changed through an IteratorType.
+template <typename Key, typename Value, typename Hasher = Hash<Key>>
+class DenseHashMap
+{
+   public:
+    struct KeyValuePair
+    {
+        Key mKey;
+        Value mValue;
+    };
+
+    using IteratorType = VectorIterator<KeyValuePair>;
+    using ConstIteratorType = VectorIterator<const KeyValuePair>;
+
+    explicit DenseHashMap(const Hasher& hasher = Hasher());
+    DenseHashMap(const DenseHashMap& other);
+    DenseHashMap(DenseHashMap&& other) noexcept;
+    DenseHashMap& operator=(const DenseHashMap& other);
+    DenseHashMap& operator=(DenseHashMap&& other) noexcept;
+    ~DenseHashMap() = default;
+
+    // Overwrites the value if the key is already present
+    void Insert(const Key& key, const Value& value);
+    // Returns false if the key was not present
+    bool Delete(const Key& key);
+    // Keeps the entry and slot capacity
+    void Clear();
+    // Makes room for count entries without growing again
+    void Reserve(const size_t count);
+
+    // Returns End() if the key is absent
+    IteratorType Find(const Key& key);
+    ConstIteratorType Find(const Key& key) const;
+    bool Contains(const Key& key) const;
+    Value& operator[](const Key& key);
+
+    size_t Size() const noexcept;
+    bool Empty() const noexcept;
+
+    IteratorType begin();
+    IteratorType end();
+    IteratorType Begin();
+    IteratorType End();
+    ConstIteratorType begin() const;
+    ConstIteratorType end() const;
+    ConstIteratorType Begin() const;
+    ConstIteratorType End() const;
+
+   private:
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+    static constexpr size_t MIN_SLOT_COUNT = 16;
+    // The home slot comes from the 32 stored hash bits
+    static constexpr size_t MAX_SLOT_COUNT = size_t{1} << 32;
+
+    struct Slot
+    {
+        // Position of the entry in mEntries, EMPTY for a free slot
+        uint32_t mIndex;
+        // Top half of the mixed hash of the key
+        uint32_t mTag;
+    };
+
+    // Position of key in mEntries, EMPTY if it is absent
+    uint32_t FindIndex(const Key& key) const;
+    uint32_t GetTag(const Key& key) const;
+    size_t GetHome(const uint32_t tag) const noexcept;
+    // Slot holding key, or the free slot that ends its probe sequence
+    size_t FindSlot(const Key& key, const uint32_t tag) const;
+    // Appends a key known to be absent, growing the table first if needed
+    Value& InsertAbsent(const Key& key, const uint32_t tag, const Value& value);
+    void Rebuild(const size_t slotCount);
+    // Closes the gap at slot by pulling later entries of the run back
+    void ShiftBack(size_t slot);
+
+   private:
+    Hasher mHasher;
+    Vector<KeyValuePair> mEntries;
+    // Not allocated before the first Insert or Reserve
+    std::unique_ptr<Slot[]> mSlots;
+    size_t mSlotCount{0};
+    // 32 - log2(mSlotCount)
+    uint32_t mShift{32};
+};
+
+}  // namespace Moon
+
+#include <MapLib/denseHashMap.ipp>
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <CommonLib/math.hpp>
+#include <HashLib/hashing.hpp>
+#include <MapLib/denseHashMap.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename Key, typename Value, typename Hasher>
+DenseHashMap<Key, Value, Hasher>::DenseHashMap(const Hasher& hasher) : mHasher(hasher)
+{
+}
+
+template <typename Key, typename Value, typename Hasher>
+DenseHashMap<Key, Value, Hasher>::DenseHashMap(const DenseHashMap& other)
+    : mHasher(other.mHasher),
+      mEntries(other.mEntries),
+      mSlots(other.mSlotCount == 0 ? nullptr : new Slot[other.mSlotCount]),
+      mSlotCount(other.mSlotCount),
+      mShift(other.mShift)
+{
+    std::copy(other.mSlots.get(), other.mSlots.get() + mSlotCount, mSlots.get());
+}
+
+template <typename Key, typename Value, typename Hasher>
+DenseHashMap<Key, Value, Hasher>::DenseHashMap(DenseHashMap&& other) noexcept
+    : mHasher(other.mHasher),
+      mEntries(std::move(other.mEntries)),
+      mSlots(std::move(other.mSlots)),
+      mSlotCount(std::exchange(other.mSlotCount, 0)),
+      mShift(std::exchange(other.mShift, 32))
+{
+}
+
+template <typename Key, typename Value, typename Hasher>
+DenseHashMap<Key, Value, Hasher>& DenseHashMap<Key, Value, Hasher>::operator=(
+    const DenseHashMap& other)
+{
+    if (this != &other)
+    {
+        *this = DenseHashMap(other);
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hasher>
+DenseHashMap<Key, Value, Hasher>& DenseHashMap<Key, Value, Hasher>::operator=(
+    DenseHashMap&& other) noexcept
+{
+    if (this != &other)
+    {
+        mHasher = other.mHasher;
+        mEntries = std::move(other.mEntries);
+        mSlots = std::move(other.mSlots);
+        mSlotCount = std::exchange(other.mSlotCount, 0);
+        mShift = std::exchange(other.mShift, 32);
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hasher>
+void DenseHashMap<Key, Value, Hasher>::Insert(const Key& key, const Value& value)
+{
+    const uint32_t tag = GetTag(key);
+    if (!Empty())
+    {
+        const size_t slot = FindSlot(key, tag);
+        if (mSlots[slot].mIndex != EMPTY)
+        {
+            mEntries[mSlots[slot].mIndex].mValue = value;
+            return;
+        }
+    }
+    InsertAbsent(key, tag, value);
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool DenseHashMap<Key, Value, Hasher>::Delete(const Key& key)
+{
+    if (Empty())
+    {
+        return false;
+    }
+    const size_t slot = FindSlot(key, GetTag(key));
+    const uint32_t index = mSlots[slot].mIndex;
+    if (index == EMPTY)
+    {
+        return false;
+    }
+    ShiftBack(slot);
+
+    // The last entry fills the hole, its slot is found by the stored index
+    const auto last = static_cast<uint32_t>(mEntries.Size() - 1);
+    if (index != last)
+    {
+        const size_t mask = mSlotCount - 1;
+        size_t lastSlot = GetHome(GetTag(mEntries[last].mKey));
+        while (mSlots[lastSlot].mIndex != last)
+        {
+            lastSlot = (lastSlot + 1) & mask;
+        }
+        mSlots[lastSlot].mIndex = index;
+        mEntries[index] = std::move(mEntries[last]);
+    }
+    mEntries.PopBack();
+    return true;
+}
+
+template <typename Key, typename Value, typename Hasher>
+void DenseHashMap<Key, Value, Hasher>::Clear()
+{
+    mEntries.Clear();
+    for (size_t slot = 0; slot < mSlotCount; ++slot)
+    {
+        mSlots[slot].mIndex = EMPTY;
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+void DenseHashMap<Key, Value, Hasher>::Reserve(const size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    mEntries.Reserve(count);
+    // Smallest power of two that keeps count entries under the load limit
+    const size_t slotCount =
+        std::max(MIN_SLOT_COUNT, Util::Math::NextPowerOfTwo(count + (count + 2) / 3));
+    if (slotCount > mSlotCount)
+    {
+        Rebuild(slotCount);
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::IteratorType DenseHashMap<Key, Value, Hasher>::Find(
+    const Key& key)
+{
+    const uint32_t index = FindIndex(key);
+    return index == EMPTY ? End() : Begin() + index;
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::ConstIteratorType
+DenseHashMap<Key, Value, Hasher>::Find(const Key& key) const
+{
+    const uint32_t index = FindIndex(key);
+    return index == EMPTY ? End() : Begin() + index;
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool DenseHashMap<Key, Value, Hasher>::Contains(const Key& key) const
+{
+    return Find(key) != End();
+}
+
+template <typename Key, typename Value, typename Hasher>
+Value& DenseHashMap<Key, Value, Hasher>::operator[](const Key& key)
+{
+    const uint32_t tag = GetTag(key);
+    if (!Empty())
+    {
+        const size_t slot = FindSlot(key, tag);
+        if (mSlots[slot].mIndex != EMPTY)
+        {
+            return mEntries[mSlots[slot].mIndex].mValue;
+        }
+    }
+    return InsertAbsent(key, tag, Value());
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t DenseHashMap<Key, Value, Hasher>::Size() const noexcept
+{
+    return mEntries.Size();
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool DenseHashMap<Key, Value, Hasher>::Empty() const noexcept
+{
+    return mEntries.Empty();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::IteratorType DenseHashMap<Key, Value, Hasher>::begin()
+{
+    return Begin();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::IteratorType DenseHashMap<Key, Value, Hasher>::end()
+{
+    return End();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::IteratorType DenseHashMap<Key, Value, Hasher>::Begin()
+{
+    return mEntries.Begin();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::IteratorType DenseHashMap<Key, Value, Hasher>::End()
+{
+    return mEntries.End();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::ConstIteratorType
+DenseHashMap<Key, Value, Hasher>::begin() const
+{
+    return Begin();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::ConstIteratorType
+DenseHashMap<Key, Value, Hasher>::end() const
+{
+    return End();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::ConstIteratorType
+DenseHashMap<Key, Value, Hasher>::Begin() const
+{
+    return mEntries.Begin();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename DenseHashMap<Key, Value, Hasher>::ConstIteratorType
+DenseHashMap<Key, Value, Hasher>::End() const
+{
+    return mEntries.End();
+}
+
+template <typename Key, typename Value, typename Hasher>
+uint32_t DenseHashMap<Key, Value, Hasher>::FindIndex(const Key& key) const
+{
+    if (Empty())
+    {
+        return EMPTY;
+    }
+    return mSlots[FindSlot(key, GetTag(key))].mIndex;
+}
+
+template <typename Key, typename Value, typename Hasher>
+uint32_t DenseHashMap<Key, Value, Hasher>::GetTag(const Key& key) const
+{
+    // Same mixing as PowerOfTwoSizing, the top bits pick the home slot
+    const uint64_t mixed = Util::Hashing::FibonacciMultiply(mHasher(key));
+    return static_cast<uint32_t>(mixed >> 32);
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t DenseHashMap<Key, Value, Hasher>::GetHome(const uint32_t tag) const noexcept
+{
+    return tag >> mShift;
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t DenseHashMap<Key, Value, Hasher>::FindSlot(const Key& key, const uint32_t tag) const
+{
+    const size_t mask = mSlotCount - 1;
+    size_t slot = GetHome(tag);
+    while (true)
+    {
+        const Slot& current = mSlots[slot];
+        if (current.mIndex == EMPTY ||
+            (current.mTag == tag && mEntries[current.mIndex].mKey == key))
+        {
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+Value& DenseHashMap<Key, Value, Hasher>::InsertAbsent(const Key& key, const uint32_t tag,
+                                                      const Value& value)
+{
+    // Three quarters full at most, which also keeps every index below EMPTY
+    if ((mEntries.Size() + 1) * 4 > mSlotCount * 3)
+    {
+        Rebuild(std::max(MIN_SLOT_COUNT, mSlotCount * 2));
+    }
+    const size_t mask = mSlotCount - 1;
+    size_t slot = GetHome(tag);
+    while (mSlots[slot].mIndex != EMPTY)
+    {
+        slot = (slot + 1) & mask;
+    }
+    mEntries.PushBack(KeyValuePair{key, value});
+    mSlots[slot] = Slot{static_cast<uint32_t>(mEntries.Size() - 1), tag};
+    return mEntries.Back().mValue;
+}
+
+template <typename Key, typename Value, typename Hasher>
+void DenseHashMap<Key, Value, Hasher>::Rebuild(const size_t slotCount)
+{
+    if (slotCount > MAX_SLOT_COUNT)
+    {
+        throw std::length_error("DenseHashMap(): too many entries");
+    }
+    std::unique_ptr<Slot[]> oldSlots(new Slot[slotCount]);
+    std::swap(oldSlots, mSlots);
+    const size_t oldSlotCount = std::exchange(mSlotCount, slotCount);
+    mShift = 32 - static_cast<uint32_t>(__builtin_ctzll(slotCount));
+    for (size_t slot = 0; slot < mSlotCount; ++slot)
+    {
+        mSlots[slot].mIndex = EMPTY;
+    }
+
+    // The stored tags give every home slot, no key is hashed again
+    const size_t mask = mSlotCount - 1;
+    for (size_t oldSlot = 0; oldSlot < oldSlotCount; ++oldSlot)
+    {
+        if (oldSlots[oldSlot].mIndex == EMPTY)
+        {
+            continue;
+        }
+        size_t slot = GetHome(oldSlots[oldSlot].mTag);
+        while (mSlots[slot].mIndex != EMPTY)
+        {
+            slot = (slot + 1) & mask;
+        }
+        mSlots[slot] = oldSlots[oldSlot];
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+void DenseHashMap<Key, Value, Hasher>::ShiftBack(size_t slot)
+{
+    const size_t mask = mSlotCount - 1;
+    size_t next = (slot + 1) & mask;
+    while (mSlots[next].mIndex != EMPTY)
+    {
+        // An entry may move back unless its home lies between the gap and it
+        const size_t home = GetHome(mSlots[next].mTag);
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            mSlots[slot] = mSlots[next];
+            slot = next;
+        }
+        next = (next + 1) & mask;
+    }
+    mSlots[slot].mIndex = EMPTY;
+}
+
+}  // namespace Moon
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <HashLib/hash.hpp>
+#include <MapLib/frozenHashMapStorage.hpp>
+#include <MapLib/hashMap.hpp>
+#include <MapLib/perfectHash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Moon
+{
+
+// Layout of the first bytes of a frozen map, the bucket seeds and then the
+// slots follow it, each starting on a FrozenHashMapStorage::ALIGNMENT boundary
+struct FrozenHashMapHeader
+{
+    static constexpr uint64_t MAGIC = 0x4e5a4f52464e4f4d;  // "MONFROZN"
+    static constexpr uint32_t VERSION = 1;
+
+    uint64_t mMagic;
+    uint32_t mVersion;
+    // A file is only readable by a map with the same Key and Value layout
+    uint32_t mKeySize;
+    uint32_t mSlotSize;
+    uint32_t mSlotAlignment;
+    uint64_t mSize;
+    uint64_t mBucketCount;
+};
+
+// Read-only map built once from a finished HashMap or a range of pairs. The
+// keys are spread over buckets of about PerfectHash::AVERAGE_BUCKET_SIZE keys,
+// and every bucket stores the seed that sends its keys to distinct free slots.
+// There are exactly as many slots as keys, so the seeds form a minimal perfect
+// hash and a lookup reads one seed and compares one key.
+//
+// The seeds and the packed key value pairs live in a single buffer that Save
+// writes out verbatim and Load maps back without parsing, so Key and Value
+// must be trivially copyable. Hasher has to hash the same way in the process
+// that loads the file, which Hash does for builds on the same platform.
+template <typename Key, typename Value, typename Hasher = Hash<Key>>
+class FrozenHashMap
+{
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                  "frozen maps are saved and mapped back byte for byte");
+
+   public:
+    struct KeyValuePair
+    {
+        Key mKey;
+        Value mValue;
+    };
+
+    static_assert(alignof(KeyValuePair) <= FrozenHashMapStorage::ALIGNMENT);
+
+    using IteratorType = const KeyValuePair*;
+
+    explicit FrozenHashMap(const Hasher& hasher = Hasher());
+    // Throws std::runtime_error if hasher gives two distinct keys the same
+    // hash, no seed can tell such keys apart
+    template <template <typename...> typename CollisionHandler>
+    explicit FrozenHashMap(const HashMap<Key, Value, Hasher, CollisionHandler>& map,
+                           const Hasher& hasher = Hasher());
+    // Elements are read through first and second, like std::pair. Throws
+    // std::invalid_argument if a key appears twice, and std::runtime_error if
+    // hasher gives two distinct keys the same hash.
+    template <typename InputIterator>
+    FrozenHashMap(InputIterator first, InputIterator last, const Hasher& hasher = Hasher());
+    FrozenHashMap(const FrozenHashMap&) = delete;
+    FrozenHashMap(FrozenHashMap&& other) noexcept;
+    FrozenHashMap& operator=(const FrozenHashMap&) = delete;
+    FrozenHashMap& operator=(FrozenHashMap&& other) noexcept;
+    ~FrozenHashMap() = default;
+
+    // Maps a file written by Save, throws std::runtime_error if it cannot be
+    // mapped or was written for other key or value types
+    static FrozenHashMap Load(const std::string& path, const Hasher& hasher = Hasher());
+    // Creates or truncates the file at path, throws std::runtime_error on failure
+    void Save(const std::string& path) const;
+
+    // Returns nullptr if the key is absent
+    const Value* Find(const Key& key) const;
+    bool Contains(const Key& key) const;
+
+    size_t Size() const noexcept;
+    bool Empty() const noexcept;
+    // Header, seeds and slots, the size of the saved file
+    size_t ByteSize() const noexcept;
+
+    IteratorType begin() const;
+    IteratorType end() const;
+    IteratorType Begin() const;
+    IteratorType End() const;
+
+   private:
+    FrozenHashMap(FrozenHashMapStorage&& storage, const Hasher& hasher);
+
+    static size_t GetSeedsOffset();
+    static size_t GetSlotsOffset(const size_t bucketCount);
+    static size_t GetByteSize(const size_t size, const size_t bucketCount);
+
+    // Throws std::invalid_argument for a duplicate key and std::runtime_error
+    // for two distinct keys with the same hash
+    void Build(const std::vector<KeyValuePair>& entries);
+    // Points the members at the header, seeds and slots of mStorage
+    void Attach();
+
+   private:
+    Hasher mHasher;
+    FrozenHashMapStorage mStorage;
+    const uint32_t* mSeeds{nullptr};
+    const KeyValuePair* mSlots{nullptr};
+    size_t mSize{0};
+    size_t mBucketCount{0};
+};
+
+}  // namespace Moon
+
+#include <MapLib/frozenHashMap.ipp>
@@ -0,0 +1,324 @@
+#pragma once
+
+#include <CommonLib/math.hpp>
+#include <MapLib/frozenHashMap.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename Key, typename Value, typename Hasher>
+FrozenHashMap<Key, Value, Hasher>::FrozenHashMap(const Hasher& hasher) : mHasher(hasher)
+{
+    Build({});
+}
+
+template <typename Key, typename Value, typename Hasher>
+template <template <typename...> typename CollisionHandler>
+FrozenHashMap<Key, Value, Hasher>::FrozenHashMap(
+    const HashMap<Key, Value, Hasher, CollisionHandler>& map, const Hasher& hasher)
+    : mHasher(hasher)
+{
+    std::vector<KeyValuePair> entries;
+    entries.reserve(map.Size());
+    for (const auto& keyValuePair : map)
+    {
+        entries.push_back(KeyValuePair{keyValuePair.mKey, keyValuePair.mValue});
+    }
+    Build(entries);
+}
+
+template <typename Key, typename Value, typename Hasher>
+template <typename InputIterator>
+FrozenHashMap<Key, Value, Hasher>::FrozenHashMap(InputIterator first, InputIterator last,
+                                                 const Hasher& hasher)
+    : mHasher(hasher)
+{
+    std::vector<KeyValuePair> entries;
+    for (; first != last; ++first)
+    {
+        entries.push_back(KeyValuePair{first->first, first->second});
+    }
+    Build(entries);
+}
+
+template <typename Key, typename Value, typename Hasher>
+FrozenHashMap<Key, Value, Hasher>::FrozenHashMap(FrozenHashMapStorage&& storage,
+                                                 const Hasher& hasher)
+    : mHasher(hasher), mStorage(std::move(storage))
+{
+    Attach();
+}
+
+// The pointers stay valid, the buffer or mapping they point into moves along
+template <typename Key, typename Value, typename Hasher>
+FrozenHashMap<Key, Value, Hasher>::FrozenHashMap(FrozenHashMap&& other) noexcept
+    : mHasher(std::move(other.mHasher)), mStorage(std::move(other.mStorage))
+{
+    Attach();
+    other.Attach();
+}
+
+template <typename Key, typename Value, typename Hasher>
+FrozenHashMap<Key, Value, Hasher>& FrozenHashMap<Key, Value, Hasher>::operator=(
+    FrozenHashMap&& other) noexcept
+{
+    if (this != &other)
+    {
+        mHasher = std::move(other.mHasher);
+        mStorage = std::move(other.mStorage);
+        Attach();
+        other.Attach();
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hasher>
+FrozenHashMap<Key, Value, Hasher> FrozenHashMap<Key, Value, Hasher>::Load(const std::string& path,
+                                                                          const Hasher& hasher)
+{
+    FrozenHashMapStorage storage(path);
+    if (storage.GetSize() < sizeof(FrozenHashMapHeader))
+    {
+        throw std::runtime_error("FrozenHashMap(): " + path + " is not a frozen map");
+    }
+    const auto* header = reinterpret_cast<const FrozenHashMapHeader*>(storage.GetData());
+    if (header->mMagic != FrozenHashMapHeader::MAGIC ||
+        header->mVersion != FrozenHashMapHeader::VERSION ||
+        header->mKeySize != sizeof(Key) || header->mSlotSize != sizeof(KeyValuePair) ||
+        header->mSlotAlignment != alignof(KeyValuePair) ||
+        header->mBucketCount != PerfectHash::GetBucketCount(header->mSize) ||
+        storage.GetSize() != GetByteSize(header->mSize, header->mBucketCount))
+    {
+        throw std::runtime_error("FrozenHashMap(): " + path +
+                                 " is not a frozen map of these key and value types");
+    }
+    return FrozenHashMap(std::move(storage), hasher);
+}
+
+template <typename Key, typename Value, typename Hasher>
+void FrozenHashMap<Key, Value, Hasher>::Save(const std::string& path) const
+{
+    mStorage.Save(path);
+}
+
+template <typename Key, typename Value, typename Hasher>
+const Value* FrozenHashMap<Key, Value, Hasher>::Find(const Key& key) const
+{
+    if (mSize == 0)
+    {
+        return nullptr;
+    }
+    const size_t hash = mHasher(key);
+    const uint32_t seed = mSeeds[PerfectHash::GetBucket(hash, mBucketCount)];
+    const auto& slot = mSlots[PerfectHash::GetSlot(hash, seed, mSize)];
+    return slot.mKey == key ? &slot.mValue : nullptr;
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool FrozenHashMap<Key, Value, Hasher>::Contains(const Key& key) const
+{
+    return Find(key) != nullptr;
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t FrozenHashMap<Key, Value, Hasher>::Size() const noexcept
+{
+    return mSize;
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool FrozenHashMap<Key, Value, Hasher>::Empty() const noexcept
+{
+    return mSize == 0;
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t FrozenHashMap<Key, Value, Hasher>::ByteSize() const noexcept
+{
+    return mStorage.GetSize();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename FrozenHashMap<Key, Value, Hasher>::IteratorType FrozenHashMap<Key, Value, Hasher>::begin()
+    const
+{
+    return mSlots;
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename FrozenHashMap<Key, Value, Hasher>::IteratorType FrozenHashMap<Key, Value, Hasher>::end()
+    const
+{
+    return mSlots + mSize;
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename FrozenHashMap<Key, Value, Hasher>::IteratorType FrozenHashMap<Key, Value, Hasher>::Begin()
+    const
+{
+    return begin();
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename FrozenHashMap<Key, Value, Hasher>::IteratorType FrozenHashMap<Key, Value, Hasher>::End()
+    const
+{
+    return end();
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t FrozenHashMap<Key, Value, Hasher>::GetSeedsOffset()
+{
+    return Util::Math::AlignSize(sizeof(FrozenHashMapHeader), FrozenHashMapStorage::ALIGNMENT);
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t FrozenHashMap<Key, Value, Hasher>::GetSlotsOffset(const size_t bucketCount)
+{
+    return Util::Math::AlignSize(GetSeedsOffset() + bucketCount * sizeof(uint32_t),
+                                 FrozenHashMapStorage::ALIGNMENT);
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t FrozenHashMap<Key, Value, Hasher>::GetByteSize(const size_t size, const size_t bucketCount)
+{
+    return GetSlotsOffset(bucketCount) + size * sizeof(KeyValuePair);
+}
+
+// Buckets are placed from the largest down, while most slots are still free.
+// Each one tries seeds 0, 1, 2, ... until all its keys land on distinct free
+// slots. The one key buckets come last and take n / free slots attempts each,
+// which adds up to about n ln n cheap attempts for the whole build.
+template <typename Key, typename Value, typename Hasher>
+void FrozenHashMap<Key, Value, Hasher>::Build(const std::vector<KeyValuePair>& entries)
+{
+    mSize = entries.size();
+    mBucketCount = PerfectHash::GetBucketCount(mSize);
+    mStorage = FrozenHashMapStorage(GetByteSize(mSize, mBucketCount));
+    std::byte* data = mStorage.GetMutableData();
+
+    auto* header = reinterpret_cast<FrozenHashMapHeader*>(data);
+    header->mMagic = FrozenHashMapHeader::MAGIC;
+    header->mVersion = FrozenHashMapHeader::VERSION;
+    header->mKeySize = sizeof(Key);
+    header->mSlotSize = sizeof(KeyValuePair);
+    header->mSlotAlignment = alignof(KeyValuePair);
+    header->mSize = mSize;
+    header->mBucketCount = mBucketCount;
+    auto* seeds = reinterpret_cast<uint32_t*>(data + GetSeedsOffset());
+    auto* slots = reinterpret_cast<KeyValuePair*>(data + GetSlotsOffset(mBucketCount));
+    mSeeds = seeds;
+    mSlots = slots;
+
+    struct PendingKey
+    {
+        size_t mBucket;
+        size_t mHash;
+        size_t mEntry;
+    };
+    std::vector<PendingKey> pendingKeys(mSize);
+    for (size_t i = 0; i < mSize; ++i)
+    {
+        const size_t hash = mHasher(entries[i].mKey);
+        pendingKeys[i] = PendingKey{PerfectHash::GetBucket(hash, mBucketCount), hash, i};
+    }
+    std::sort(pendingKeys.begin(), pendingKeys.end(), [](const auto& a, const auto& b) {
+        return a.mBucket != b.mBucket ? a.mBucket < b.mBucket : a.mHash < b.mHash;
+    });
+
+    // Keys with the same hash land on the same slot for every seed
+    for (size_t i = 1; i < mSize; ++i)
+    {
+        if (pendingKeys[i].mHash == pendingKeys[i - 1].mHash)
+        {
+            if (entries[pendingKeys[i].mEntry].mKey == entries[pendingKeys[i - 1].mEntry].mKey)
+            {
+                throw std::invalid_argument("FrozenHashMap(): duplicate key");
+            }
+            throw std::runtime_error("FrozenHashMap(): Hasher maps two keys to the same hash");
+        }
+    }
+
+    // [first, last) ranges of pendingKeys, largest first
+    std::vector<std::pair<size_t, size_t>> buckets;
+    buckets.reserve(mBucketCount);
+    for (size_t first = 0; first < mSize;)
+    {
+        size_t last = first + 1;
+        while (last < mSize && pendingKeys[last].mBucket == pendingKeys[first].mBucket)
+        {
+            ++last;
+        }
+        buckets.emplace_back(first, last);
+        first = last;
+    }
+    std::stable_sort(buckets.begin(), buckets.end(), [](const auto& a, const auto& b) {
+        return a.second - a.first > b.second - b.first;
+    });
+
+    std::vector<bool> taken(mSize, false);
+    std::vector<size_t> bucketSlots;
+    for (const auto& [first, last] : buckets)
+    {
+        uint32_t seed = 0;
+        while (true)
+        {
+            bucketSlots.clear();
+            for (size_t i = first; i < last; ++i)
+            {
+                const size_t slot = PerfectHash::GetSlot(pendingKeys[i].mHash, seed, mSize);
+                if (taken[slot] ||
+                    std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                {
+                    break;
+                }
+                bucketSlots.push_back(slot);
+            }
+            if (bucketSlots.size() == last - first)
+            {
+                break;
+            }
+            if (seed == std::numeric_limits<uint32_t>::max())
+            {
+                throw std::runtime_error("FrozenHashMap(): no seed places a bucket");
+            }
+            ++seed;
+        }
+
+        seeds[pendingKeys[first].mBucket] = seed;
+        for (size_t i = first; i < last; ++i)
+        {
+            const size_t slot = bucketSlots[i - first];
+            taken[slot] = true;
+            std::memcpy(static_cast<void*>(slots + slot), &entries[pendingKeys[i].mEntry],
+                        sizeof(KeyValuePair));
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+void FrozenHashMap<Key, Value, Hasher>::Attach()
+{
+    const std::byte* data = mStorage.GetData();
+    if (data == nullptr)
+    {
+        mSeeds = nullptr;
+        mSlots = nullptr;
+        mSize = 0;
+        mBucketCount = 0;
+        return;
+    }
+    const auto* header = reinterpret_cast<const FrozenHashMapHeader*>(data);
+    mSize = header->mSize;
+    mBucketCount = header->mBucketCount;
+    mSeeds = reinterpret_cast<const uint32_t*>(data + GetSeedsOffset());
+    mSlots = reinterpret_cast<const KeyValuePair*>(data + GetSlotsOffset(mBucketCount));
+}
+
+}  // namespace Moon
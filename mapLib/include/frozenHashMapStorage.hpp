@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Moon
+{
+
+// Bytes of a FrozenHashMap, either an owned zeroed buffer or a read-only
+// mapping of a file written by Save. Either way the data is ALIGNMENT aligned.
+class FrozenHashMapStorage
+{
+   public:
+    static constexpr size_t ALIGNMENT = 64;
+
+    FrozenHashMapStorage();
+    explicit FrozenHashMapStorage(const size_t size);
+    // Maps the whole file, throws std::runtime_error if it cannot be opened or mapped
+    explicit FrozenHashMapStorage(const std::string& path);
+    FrozenHashMapStorage(const FrozenHashMapStorage&) = delete;
+    FrozenHashMapStorage(FrozenHashMapStorage&& other) noexcept;
+    FrozenHashMapStorage& operator=(const FrozenHashMapStorage&) = delete;
+    FrozenHashMapStorage& operator=(FrozenHashMapStorage&& other) noexcept;
+    ~FrozenHashMapStorage();
+
+    // Creates or truncates the file at path, throws std::runtime_error on failure
+    void Save(const std::string& path) const;
+
+    const std::byte* GetData() const;
+    // nullptr for a mapped file, only owned buffers are writable
+    std::byte* GetMutableData();
+    size_t GetSize() const;
+    bool IsMapped() const;
+
+   private:
+    void Release();
+
+   private:
+    std::byte* mData;
+    size_t mSize;
+    bool mIsMapped;
+};
+}  // namespace Moon
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <CollisionHandlerLib/swissTableCollisionHandler.hpp>
+#include <HashLib/hash.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Moon
+{
+
+// A hasher opts into heterogeneous lookup by declaring an is_transparent
+// member type, as the standard unordered containers expect
+template <typename Hasher, typename = void>
+struct IsTransparentHasher : std::false_type
+{
+};
+
+template <typename Hasher>
+struct IsTransparentHasher<Hasher, std::void_t<typename Hasher::is_transparent>> : std::true_type
+{
+};
+
+// CollisionHandler is instantiated as CollisionHandler<KeyValuePair, KeyValuePairHasher>,
+// any further template parameters keep their defaults
+template <typename Key, typename Value, typename Hasher = Hash<Key>,
+          template <typename...> typename CollisionHandler = SwissTableCollisionHandler>
+class HashMap
+{
+   public:
+    struct KeyValuePair
+    {
+        Key mKey;
+        Value mValue;
+    };
+
+    // Lets the collision handler rehash its elements without knowing Key
+    struct KeyValuePairHasher
+    {
+        size_t operator()(const KeyValuePair& keyValuePair) const
+        {
+            return mHasher(keyValuePair.mKey);
+        }
+
+        Hasher mHasher;
+    };
+
+    using CollisionHandlerType = CollisionHandler<KeyValuePair, KeyValuePairHasher>;
+    using IteratorType = typename CollisionHandlerType::IteratorType;
+
+    // Lookup key types other than Key, usable when Hasher is transparent.
+    // They must hash like the Key they stand for and compare equal to it with ==.
+    template <typename LookupKey>
+    using EnableIfLookupKey = std::enable_if_t<IsTransparentHasher<Hasher>::value &&
+                                               !std::is_same_v<std::decay_t<LookupKey>, Key>>;
+
+    HashMap(const Hasher& hasher = Hasher())
+        : mHasher(hasher), mCollisionHandler(0, KeyValuePairHasher{hasher})
+    {
+    }
+
+    HashMap(const size_t bucketCount, const Hasher& hasher = Hasher())
+        : mHasher(hasher), mCollisionHandler(bucketCount, KeyValuePairHasher{hasher})
+    {
+    }
+
+    HashMap(const HashMap& other) = default;
+    HashMap(HashMap&& other) = default;
+    HashMap& operator=(const HashMap& other) = default;
+    HashMap& operator=(HashMap&& other) = default;
+
+    void Insert(const Key& key, const Value& value);
+    // Returns false if the key was not present
+    bool Delete(const Key& key);
+    template <typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+    bool Delete(const LookupKey& key);
+    void Clear();
+    IteratorType Find(const Key& key);
+    template <typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+    IteratorType Find(const LookupKey& key);
+    bool Contains(const Key& key);
+    template <typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+    bool Contains(const LookupKey& key);
+
+    // Hashing a key once and passing the hash to the *WithHash calls saves
+    // rehashing it on every map or shard it is looked up in. The hash must
+    // come from HashOf of a map with the same Hasher.
+    size_t HashOf(const Key& key) const;
+    template <typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+    size_t HashOf(const LookupKey& key) const;
+    void InsertWithHash(const Key& key, const Value& value, const size_t hash);
+    bool DeleteWithHash(const Key& key, const size_t hash);
+    template <typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+    bool DeleteWithHash(const LookupKey& key, const size_t hash);
+    IteratorType FindWithHash(const Key& key, const size_t hash);
+    template <typename LookupKey, typename = EnableIfLookupKey<LookupKey>>
+    IteratorType FindWithHash(const LookupKey& key, const size_t hash);
+
+    // Look up or insert count keys at once. Each group of BATCH_SIZE keys is
+    // hashed and has its home slots prefetched before any of them is probed,
+    // so the cache misses of a group overlap instead of queueing up.
+    // FindBatch writes one iterator per key to out.
+    void FindBatch(const Key* keys, const size_t count, IteratorType* out);
+    void InsertBatch(const Key* keys, const Value* values, const size_t count);
+
+    size_t Size() const noexcept;
+    bool Empty() const noexcept;
+
+    Value& operator[](const Key& key);
+
+    IteratorType begin() const;
+    IteratorType end() const;
+    IteratorType Begin() const;
+    IteratorType End() const;
+
+   private:
+    static constexpr size_t BATCH_SIZE = 16;
+
+    Hasher mHasher;
+    CollisionHandlerType mCollisionHandler;
+};
+
+}  // namespace Moon
+
+#include <MapLib/hashMap.ipp>
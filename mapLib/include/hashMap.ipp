@@ -0,0 +1,223 @@
+#pragma once
+
+#include <MapLib/hashMap.hpp>
+
+#include <algorithm>
+
+namespace Moon
+{
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+void HashMap<Key, Value, Hasher, CollisionHandler>::Insert(const Key& key,
+                                                           const Value& value)
+{
+    InsertWithHash(key, value, HashOf(key));
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+bool HashMap<Key, Value, Hasher, CollisionHandler>::Delete(const Key& key)
+{
+    return DeleteWithHash(key, HashOf(key));
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+template <typename LookupKey, typename>
+bool HashMap<Key, Value, Hasher, CollisionHandler>::Delete(const LookupKey& key)
+{
+    return DeleteWithHash(key, HashOf(key));
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+void HashMap<Key, Value, Hasher, CollisionHandler>::Clear()
+{
+    mCollisionHandler.Clear();
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+Value& HashMap<Key, Value, Hasher, CollisionHandler>::operator[](const Key& key)
+{
+    return mCollisionHandler.LookupOrDefaultConstruct(HashOf(key), key).mValue;
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::Find(const Key& key)
+{
+    return FindWithHash(key, HashOf(key));
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+template <typename LookupKey, typename>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::Find(const LookupKey& key)
+{
+    return FindWithHash(key, HashOf(key));
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+bool HashMap<Key, Value, Hasher, CollisionHandler>::Contains(const Key& key)
+{
+    return Find(key) != End();
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+template <typename LookupKey, typename>
+bool HashMap<Key, Value, Hasher, CollisionHandler>::Contains(const LookupKey& key)
+{
+    return Find(key) != End();
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+size_t HashMap<Key, Value, Hasher, CollisionHandler>::HashOf(const Key& key) const
+{
+    return mHasher(key);
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+template <typename LookupKey, typename>
+size_t HashMap<Key, Value, Hasher, CollisionHandler>::HashOf(const LookupKey& key) const
+{
+    return mHasher(key);
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+void HashMap<Key, Value, Hasher, CollisionHandler>::InsertWithHash(const Key& key, const Value& value,
+                                                                   const size_t hash)
+{
+    mCollisionHandler.Insert(hash, KeyValuePair{key, value});
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+bool HashMap<Key, Value, Hasher, CollisionHandler>::DeleteWithHash(const Key& key, const size_t hash)
+{
+    return mCollisionHandler.Delete(hash, key);
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+template <typename LookupKey, typename>
+bool HashMap<Key, Value, Hasher, CollisionHandler>::DeleteWithHash(const LookupKey& key, const size_t hash)
+{
+    return mCollisionHandler.Delete(hash, key);
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::FindWithHash(const Key& key, const size_t hash)
+{
+    return mCollisionHandler.Find(hash, key);
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+template <typename LookupKey, typename>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::FindWithHash(const LookupKey& key, const size_t hash)
+{
+    return mCollisionHandler.Find(hash, key);
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+void HashMap<Key, Value, Hasher, CollisionHandler>::FindBatch(const Key* keys, const size_t count,
+                                                              IteratorType* out)
+{
+    size_t hashes[BATCH_SIZE];
+    for (size_t batchStart = 0; batchStart < count; batchStart += BATCH_SIZE)
+    {
+        const size_t batchSize = std::min(BATCH_SIZE, count - batchStart);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            hashes[i] = HashOf(keys[batchStart + i]);
+            mCollisionHandler.Prefetch(hashes[i]);
+        }
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            out[batchStart + i] = FindWithHash(keys[batchStart + i], hashes[i]);
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+void HashMap<Key, Value, Hasher, CollisionHandler>::InsertBatch(const Key* keys, const Value* values,
+                                                                const size_t count)
+{
+    size_t hashes[BATCH_SIZE];
+    for (size_t batchStart = 0; batchStart < count; batchStart += BATCH_SIZE)
+    {
+        const size_t batchSize = std::min(BATCH_SIZE, count - batchStart);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            hashes[i] = HashOf(keys[batchStart + i]);
+            mCollisionHandler.Prefetch(hashes[i]);
+        }
+        // A growing table only makes the remaining prefetches useless
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            InsertWithHash(keys[batchStart + i], values[batchStart + i], hashes[i]);
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+size_t HashMap<Key, Value, Hasher, CollisionHandler>::Size() const noexcept
+{
+    return mCollisionHandler.Size();
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+bool HashMap<Key, Value, Hasher, CollisionHandler>::Empty() const noexcept
+{
+    return Size() == 0;
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::begin() const
+{
+    return mCollisionHandler.begin();
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::end() const
+{
+    return mCollisionHandler.end();
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::Begin() const
+{
+    return begin();
+}
+
+template <typename Key, typename Value, typename Hasher,
+          template <typename...> typename CollisionHandler>
+typename HashMap<Key, Value, Hasher, CollisionHandler>::IteratorType
+HashMap<Key, Value, Hasher, CollisionHandler>::End() const
+{
+    return end();
+}
+
+}  // namespace Moon
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <HashLib/hash.hpp>
+#include <VectorLib/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Moon
+{
+
+// Cache that evicts its least recently used entries once they take more than
+// a byte capacity. Keys are spread over a power of two number of shards, each
+// with its own mutex, its own share of the capacity and its own recency
+// order, so threads working on different keys rarely wait on each other.
+//
+// A shard indexes its keys with an open addressing table that maps them to
+// nodes in a Vector. The nodes form a doubly linked list from the most to the
+// least recently used entry, linked by index, and evicted nodes are reused
+// through a free list. A hit relinks three nodes. Read through the Find that
+// takes a function it allocates nothing, the Find that copies the value out
+// allocates whenever copying a Value does.
+//
+// Value must be default constructible, an evicted node is reset to Value()
+// so that it does not hold on to the resources of the value.
+template <typename Key, typename Value, typename Hasher = Hash<Key>>
+class LruCache
+{
+   public:
+    // Runs with the shard locked, it must not use the cache
+    using EvictionCallback = std::function<void(const Key& key, const Value& value)>;
+
+    static constexpr size_t DEFAULT_SHARD_COUNT = 16;
+    static constexpr size_t DEFAULT_ENTRY_BYTES = sizeof(Key) + sizeof(Value);
+
+    // byteCapacity is split evenly between the shards, shardCount is rounded
+    // up to a power of two
+    explicit LruCache(const size_t byteCapacity, const size_t shardCount = DEFAULT_SHARD_COUNT,
+                      EvictionCallback onEviction = EvictionCallback(),
+                      const Hasher& hasher = Hasher());
+    LruCache(const LruCache&) = delete;
+    LruCache(LruCache&&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+    LruCache& operator=(LruCache&&) = delete;
+    ~LruCache() = default;
+
+    // Stores value as the most recently used entry of its shard, replacing
+    // the value of a present key, and evicts the least recently used entries
+    // until the shard fits its capacity again. bytes is what the entry counts
+    // against the capacity. Returns false and changes nothing if bytes alone
+    // exceeds the capacity of a shard.
+    bool Insert(const Key& key, const Value& value, const size_t bytes = DEFAULT_ENTRY_BYTES);
+    // Copies the value of key into value and makes it the most recently used
+    // entry, returns false if the key is absent
+    bool Find(const Key& key, Value& value);
+    // Calls function(const Value&) on the value of key and makes it the most
+    // recently used entry, returns false if the key is absent. Runs with the
+    // shard locked, function must not use the cache.
+    template <typename Function>
+    bool Find(const Key& key, Function&& function);
+    // Leaves the recency order alone
+    bool Contains(const Key& key) const;
+    // Does not call the eviction callback. Returns false if the key was not
+    // present.
+    bool Delete(const Key& key);
+    // Does not call the eviction callback
+    void Clear();
+
+    // Shards are counted one after another, concurrent writes may or may not
+    // be included
+    size_t Size() const;
+    size_t GetBytes() const;
+    size_t GetByteCapacity() const noexcept;
+    size_t GetShardCount() const noexcept;
+
+   private:
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+    struct Node
+    {
+        Key mKey;
+        Value mValue;
+        size_t mBytes;
+        // Towards the most and the least recently used end of the list
+        uint32_t mPrevious;
+        uint32_t mNext;
+    };
+
+    // mValue is the node of the key
+    struct IndexEntry
+    {
+        Key mKey;
+        uint32_t mValue;
+    };
+
+    struct IndexEntryHasher
+    {
+        size_t operator()(const IndexEntry& indexEntry) const
+        {
+            return mHasher(indexEntry.mKey);
+        }
+
+        Hasher mHasher;
+    };
+
+    using IndexType = OpenAddressingCollisionHandler<IndexEntry, IndexEntryHasher>;
+
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mMutex;
+        IndexType mIndex;
+        Vector<Node> mNodes;
+        uint32_t mMostRecent{NO_NODE};
+        uint32_t mLeastRecent{NO_NODE};
+        // Unused nodes, chained through mNext
+        uint32_t mFree{NO_NODE};
+        size_t mBytes{0};
+    };
+
+    Shard& GetShard(const size_t hash) const;
+
+    static void Unlink(Shard& shard, const uint32_t node);
+    static void LinkMostRecent(Shard& shard, const uint32_t node);
+    // Takes a node from the free list or appends one
+    static uint32_t AcquireNode(Shard& shard, const Key& key, const Value& value,
+                                const size_t bytes);
+    static void ReleaseNode(Shard& shard, const uint32_t node);
+    // Evicts the least recently used entry of the shard
+    void EvictLeastRecent(Shard& shard);
+
+   private:
+    Hasher mHasher;
+    EvictionCallback mOnEviction;
+    size_t mShardMask;
+    size_t mShardByteCapacity;
+    std::unique_ptr<Shard[]> mShards;
+};
+
+}  // namespace Moon
+
+#include <MapLib/lruCache.ipp>
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <CommonLib/math.hpp>
+#include <HashLib/hashing.hpp>
+#include <MapLib/lruCache.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename Key, typename Value, typename Hasher>
+LruCache<Key, Value, Hasher>::LruCache(const size_t byteCapacity, const size_t shardCount,
+                                       EvictionCallback onEviction, const Hasher& hasher)
+    : mHasher(hasher),
+      mOnEviction(std::move(onEviction)),
+      mShardMask(Util::Math::NextPowerOfTwo(shardCount) - 1),
+      mShardByteCapacity(byteCapacity / (mShardMask + 1)),
+      mShards(std::make_unique<Shard[]>(mShardMask + 1))
+{
+    if (mShardByteCapacity == 0)
+    {
+        throw std::invalid_argument("LruCache(): byteCapacity leaves a shard no bytes");
+    }
+    for (size_t i = 0; i <= mShardMask; ++i)
+    {
+        mShards[i].mIndex = IndexType(0, IndexEntryHasher{mHasher});
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool LruCache<Key, Value, Hasher>::Insert(const Key& key, const Value& value, const size_t bytes)
+{
+    if (bytes > mShardByteCapacity)
+    {
+        return false;
+    }
+    const size_t hash = mHasher(key);
+    auto& shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mMutex);
+    const auto it = shard.mIndex.Find(hash, key);
+    if (it != shard.mIndex.End())
+    {
+        const uint32_t node = it->mValue;
+        Node& entry = shard.mNodes[node];
+        entry.mValue = value;
+        shard.mBytes = shard.mBytes - entry.mBytes + bytes;
+        entry.mBytes = bytes;
+        Unlink(shard, node);
+        LinkMostRecent(shard, node);
+        // The entry fits on its own and is the most recent, so it is never
+        // the one evicted
+        while (shard.mBytes > mShardByteCapacity)
+        {
+            EvictLeastRecent(shard);
+        }
+        return true;
+    }
+
+    // Evicting first lets the new entry reuse a freed node
+    while (shard.mBytes + bytes > mShardByteCapacity)
+    {
+        EvictLeastRecent(shard);
+    }
+    const uint32_t node = AcquireNode(shard, key, value, bytes);
+    shard.mIndex.Insert(hash, IndexEntry{key, node});
+    LinkMostRecent(shard, node);
+    shard.mBytes += bytes;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool LruCache<Key, Value, Hasher>::Find(const Key& key, Value& value)
+{
+    return Find(key, [&value](const Value& found) { value = found; });
+}
+
+template <typename Key, typename Value, typename Hasher>
+template <typename Function>
+bool LruCache<Key, Value, Hasher>::Find(const Key& key, Function&& function)
+{
+    const size_t hash = mHasher(key);
+    auto& shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mMutex);
+    const auto it = shard.mIndex.Find(hash, key);
+    if (it == shard.mIndex.End())
+    {
+        return false;
+    }
+    const uint32_t node = it->mValue;
+    if (node != shard.mMostRecent)
+    {
+        Unlink(shard, node);
+        LinkMostRecent(shard, node);
+    }
+    const Value& value = shard.mNodes[node].mValue;
+    function(value);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool LruCache<Key, Value, Hasher>::Contains(const Key& key) const
+{
+    const size_t hash = mHasher(key);
+    const auto& shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mMutex);
+    return shard.mIndex.Find(hash, key) != shard.mIndex.End();
+}
+
+template <typename Key, typename Value, typename Hasher>
+bool LruCache<Key, Value, Hasher>::Delete(const Key& key)
+{
+    const size_t hash = mHasher(key);
+    auto& shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mMutex);
+    const auto it = shard.mIndex.Find(hash, key);
+    if (it == shard.mIndex.End())
+    {
+        return false;
+    }
+    const uint32_t node = it->mValue;
+    shard.mIndex.Delete(hash, key);
+    Unlink(shard, node);
+    ReleaseNode(shard, node);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hasher>
+void LruCache<Key, Value, Hasher>::Clear()
+{
+    for (size_t i = 0; i <= mShardMask; ++i)
+    {
+        auto& shard = mShards[i];
+        std::lock_guard<std::mutex> lock(shard.mMutex);
+        shard.mIndex.Clear();
+        shard.mNodes.Clear();
+        shard.mMostRecent = NO_NODE;
+        shard.mLeastRecent = NO_NODE;
+        shard.mFree = NO_NODE;
+        shard.mBytes = 0;
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t LruCache<Key, Value, Hasher>::Size() const
+{
+    size_t size = 0;
+    for (size_t i = 0; i <= mShardMask; ++i)
+    {
+        const auto& shard = mShards[i];
+        std::lock_guard<std::mutex> lock(shard.mMutex);
+        size += shard.mIndex.Size();
+    }
+    return size;
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t LruCache<Key, Value, Hasher>::GetBytes() const
+{
+    size_t bytes = 0;
+    for (size_t i = 0; i <= mShardMask; ++i)
+    {
+        const auto& shard = mShards[i];
+        std::lock_guard<std::mutex> lock(shard.mMutex);
+        bytes += shard.mBytes;
+    }
+    return bytes;
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t LruCache<Key, Value, Hasher>::GetByteCapacity() const noexcept
+{
+    return mShardByteCapacity * (mShardMask + 1);
+}
+
+template <typename Key, typename Value, typename Hasher>
+size_t LruCache<Key, Value, Hasher>::GetShardCount() const noexcept
+{
+    return mShardMask + 1;
+}
+
+template <typename Key, typename Value, typename Hasher>
+typename LruCache<Key, Value, Hasher>::Shard& LruCache<Key, Value, Hasher>::GetShard(
+    const size_t hash) const
+{
+    // Same split as ConcurrentHashMap, the index takes its home slot from
+    // the top bits of the hash
+    const uint64_t mixed = Util::Hashing::FibonacciMultiply(hash);
+    return mShards[(mixed >> 32) & mShardMask];
+}
+
+template <typename Key, typename Value, typename Hasher>
+void LruCache<Key, Value, Hasher>::Unlink(Shard& shard, const uint32_t node)
+{
+    const Node& entry = shard.mNodes[node];
+    if (entry.mPrevious == NO_NODE)
+    {
+        shard.mMostRecent = entry.mNext;
+    }
+    else
+    {
+        shard.mNodes[entry.mPrevious].mNext = entry.mNext;
+    }
+    if (entry.mNext == NO_NODE)
+    {
+        shard.mLeastRecent = entry.mPrevious;
+    }
+    else
+    {
+        shard.mNodes[entry.mNext].mPrevious = entry.mPrevious;
+    }
+}
+
+template <typename Key, typename Value, typename Hasher>
+void LruCache<Key, Value, Hasher>::LinkMostRecent(Shard& shard, const uint32_t node)
+{
+    Node& entry = shard.mNodes[node];
+    entry.mPrevious = NO_NODE;
+    entry.mNext = shard.mMostRecent;
+    if (shard.mMostRecent == NO_NODE)
+    {
+        shard.mLeastRecent = node;
+    }
+    else
+    {
+        shard.mNodes[shard.mMostRecent].mPrevious = node;
+    }
+    shard.mMostRecent = node;
+}
+
+template <typename Key, typename Value, typename Hasher>
+uint32_t LruCache<Key, Value, Hasher>::AcquireNode(Shard& shard, const Key& key,
+                                                   const Value& value, const size_t bytes)
+{
+    if (shard.mFree != NO_NODE)
+    {
+        const uint32_t node = shard.mFree;
+        Node& entry = shard.mNodes[node];
+        shard.mFree = entry.mNext;
+        entry.mKey = key;
+        entry.mValue = value;
+        entry.mBytes = bytes;
+        return node;
+    }
+    if (shard.mNodes.Size() == NO_NODE)
+    {
+        throw std::length_error("LruCache(): too many entries in one shard");
+    }
+    shard.mNodes.PushBack(Node{key, value, bytes, NO_NODE, NO_NODE});
+    return static_cast<uint32_t>(shard.mNodes.Size() - 1);
+}
+
+template <typename Key, typename Value, typename Hasher>
+void LruCache<Key, Value, Hasher>::ReleaseNode(Shard& shard, const uint32_t node)
+{
+    Node& entry = shard.mNodes[node];
+    shard.mBytes -= entry.mBytes;
+    entry.mValue = Value();
+    entry.mNext = shard.mFree;
+    shard.mFree = node;
+}
+
+template <typename Key, typename Value, typename Hasher>
+void LruCache<Key, Value, Hasher>::EvictLeastRecent(Shard& shard)
+{
+    const uint32_t node = shard.mLeastRecent;
+    const Node& entry = shard.mNodes[node];
+    if (mOnEviction)
+    {
+        mOnEviction(entry.mKey, entry.mValue);
+    }
+    shard.mIndex.Delete(mHasher(entry.mKey), entry.mKey);
+    Unlink(shard, node);
+    ReleaseNode(shard, node);
+}
+
+}  // namespace Moon
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <HashLib/hashing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Moon
+{
+
+// Hash and displace (CHD) layout shared by FrozenHashMap and ConstexprMap.
+// A key goes to a bucket by its hash alone, and to a slot by its hash and
+// the seed stored for its bucket. A build picks every seed so that the keys
+// of a bucket land on distinct slots no other bucket took.
+class PerfectHash
+{
+   public:
+    static constexpr size_t AVERAGE_BUCKET_SIZE = 4;
+
+    static constexpr size_t GetBucketCount(const size_t keyCount)
+    {
+        return (keyCount + AVERAGE_BUCKET_SIZE - 1) / AVERAGE_BUCKET_SIZE;
+    }
+
+    // One fold first, so that a hasher with weak high bits such as the
+    // identity std::hash still spreads the keys over the buckets
+    static constexpr size_t GetBucket(const uint64_t hash, const size_t bucketCount)
+    {
+        return Reduce(Util::Hashing::MultiplyFold(hash, Util::Hashing::SECRET[2]), bucketCount);
+    }
+
+    // The seed is spread over all 64 bits first. Left in the low bits it would
+    // barely move hashes that differ by little relative to each other, and the
+    // keys of a bucket would keep colliding whatever the seed.
+    static constexpr size_t GetSlot(const uint64_t hash, const uint32_t seed, const size_t slotCount)
+    {
+        return Reduce(Util::Hashing::Combine(hash, Util::Hashing::FibonacciMultiply(seed)),
+                      slotCount);
+    }
+
+   private:
+    // Maps a hash onto [0, range) with its high bits
+    static constexpr size_t Reduce(const uint64_t hash, const size_t range)
+    {
+        return static_cast<size_t>((static_cast<__uint128_t>(hash) * range) >> 64);
+    }
+};
+}  // namespace Moon
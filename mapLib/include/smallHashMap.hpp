@@ -0,0 +1,98 @@
+#pragma once
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <HashLib/hash.hpp>
+#include <MapLib/smallKeyScan.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace Moon
+{
+
+// Map that keeps up to N entries inline, keys and values in two arrays, and
+// finds a key by scanning the keys with SmallKeyScan. Nothing is hashed and
+// nothing is allocated until the N + 1th key arrives, which moves every
+// entry into an OpenAddressingCollisionHandler on the heap. The map stays
+// there when it shrinks again, only Clear returns it to the inline arrays.
+template <typename Key, typename Value, size_t N = 8, typename Hasher = Hash<Key>>
+class SmallHashMap
+{
+    static_assert(N > 0, "a SmallHashMap needs room for at least one inline entry");
+
+   public:
+    struct KeyValuePair
+    {
+        Key mKey;
+        Value mValue;
+    };
+
+    struct KeyValuePairHasher
+    {
+        size_t operator()(const KeyValuePair& keyValuePair) const
+        {
+            return mHasher(keyValuePair.mKey);
+        }
+
+        Hasher mHasher;
+    };
+
+    using CollisionHandlerType = OpenAddressingCollisionHandler<KeyValuePair, KeyValuePairHasher>;
+
+    explicit SmallHashMap(const Hasher& hasher = Hasher());
+    SmallHashMap(const SmallHashMap& other);
+    SmallHashMap(SmallHashMap&& other) noexcept;
+    SmallHashMap& operator=(const SmallHashMap& other);
+    SmallHashMap& operator=(SmallHashMap&& other) noexcept;
+    ~SmallHashMap();
+
+    // Overwrites the value if the key is already present
+    void Insert(const Key& key, const Value& value);
+    // Returns false if the key was not present
+    bool Delete(const Key& key);
+    void Clear();
+
+    // Returns nullptr if the key is absent
+    Value* Find(const Key& key);
+    const Value* Find(const Key& key) const;
+    bool Contains(const Key& key) const;
+    Value& operator[](const Key& key);
+
+    // Calls function(key, value) for every entry
+    template <typename Function>
+    void ForEach(Function&& function) const;
+
+    size_t Size() const noexcept;
+    bool Empty() const noexcept;
+    // False once the entries moved into the heap table
+    bool IsInline() const noexcept;
+
+   private:
+    using KeyScan = SmallKeyScan<Key>;
+
+    Key* GetKeys();
+    const Key* GetKeys() const;
+    Value* GetValues();
+    const Value* GetValues() const;
+
+    // Appends a key known to be absent, moving to the heap table if the
+    // inline arrays are full
+    Value& InsertAbsent(const Key& key, const Value& value);
+    void MoveToTable();
+    void DestroyInline();
+    void CopyFrom(const SmallHashMap& other);
+    void MoveFrom(SmallHashMap& other);
+
+   private:
+    // First and chunk aligned so the scan never loads across a cache line.
+    // Zeroed so that it never reads uninitialised bytes either.
+    alignas(KeyScan::ALIGNMENT) std::byte mKeys[KeyScan::GetStorageSize(N)]{};
+    alignas(Value) std::byte mValues[N * sizeof(Value)];
+    size_t mInlineSize{0};
+    std::unique_ptr<CollisionHandlerType> mTable;
+    Hasher mHasher;
+};
+
+}  // namespace Moon
+
+#include <MapLib/smallHashMap.ipp>
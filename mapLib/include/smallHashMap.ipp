@@ -0,0 +1,288 @@
+#pragma once
+
+#include <MapLib/smallHashMap.hpp>
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+SmallHashMap<Key, Value, N, Hasher>::SmallHashMap(const Hasher& hasher) : mHasher(hasher)
+{
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+SmallHashMap<Key, Value, N, Hasher>::SmallHashMap(const SmallHashMap& other)
+    : mHasher(other.mHasher)
+{
+    CopyFrom(other);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+SmallHashMap<Key, Value, N, Hasher>::SmallHashMap(SmallHashMap&& other) noexcept
+    : mHasher(other.mHasher)
+{
+    MoveFrom(other);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+SmallHashMap<Key, Value, N, Hasher>& SmallHashMap<Key, Value, N, Hasher>::operator=(
+    const SmallHashMap& other)
+{
+    if (this != &other)
+    {
+        Clear();
+        mHasher = other.mHasher;
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+SmallHashMap<Key, Value, N, Hasher>& SmallHashMap<Key, Value, N, Hasher>::operator=(
+    SmallHashMap&& other) noexcept
+{
+    if (this != &other)
+    {
+        Clear();
+        mHasher = other.mHasher;
+        MoveFrom(other);
+    }
+    return *this;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+SmallHashMap<Key, Value, N, Hasher>::~SmallHashMap()
+{
+    DestroyInline();
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+void SmallHashMap<Key, Value, N, Hasher>::Insert(const Key& key, const Value& value)
+{
+    if (mTable)
+    {
+        mTable->Insert(mHasher(key), KeyValuePair{key, value});
+        return;
+    }
+    const size_t index = KeyScan::template Find<N>(GetKeys(), mInlineSize, key);
+    if (index < mInlineSize)
+    {
+        GetValues()[index] = value;
+        return;
+    }
+    InsertAbsent(key, value);
+}
+
+// The last entry fills the hole, the order of the inline entries is not kept
+template <typename Key, typename Value, size_t N, typename Hasher>
+bool SmallHashMap<Key, Value, N, Hasher>::Delete(const Key& key)
+{
+    if (mTable)
+    {
+        return mTable->Delete(mHasher(key), key);
+    }
+    const size_t index = KeyScan::template Find<N>(GetKeys(), mInlineSize, key);
+    if (index == mInlineSize)
+    {
+        return false;
+    }
+    const size_t last = mInlineSize - 1;
+    if (index != last)
+    {
+        GetKeys()[index] = std::move(GetKeys()[last]);
+        GetValues()[index] = std::move(GetValues()[last]);
+    }
+    GetKeys()[last].~Key();
+    GetValues()[last].~Value();
+    mInlineSize = last;
+    return true;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+void SmallHashMap<Key, Value, N, Hasher>::Clear()
+{
+    mTable.reset();
+    DestroyInline();
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+Value* SmallHashMap<Key, Value, N, Hasher>::Find(const Key& key)
+{
+    return const_cast<Value*>(std::as_const(*this).Find(key));
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+const Value* SmallHashMap<Key, Value, N, Hasher>::Find(const Key& key) const
+{
+    if (mTable)
+    {
+        const CollisionHandlerType& table = *mTable;
+        const auto it = table.Find(mHasher(key), key);
+        return it == table.End() ? nullptr : &it->mValue;
+    }
+    const size_t index = KeyScan::template Find<N>(GetKeys(), mInlineSize, key);
+    // Masked rather than selected, GCC turns the select into a branch on
+    // whether the key was found which the scan went out of its way to avoid
+    const auto found = static_cast<uintptr_t>(index < mInlineSize);
+    return reinterpret_cast<const Value*>(reinterpret_cast<uintptr_t>(GetValues() + index) &
+                                          (uintptr_t{0} - found));
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+bool SmallHashMap<Key, Value, N, Hasher>::Contains(const Key& key) const
+{
+    return Find(key) != nullptr;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+Value& SmallHashMap<Key, Value, N, Hasher>::operator[](const Key& key)
+{
+    if (mTable)
+    {
+        return mTable->LookupOrDefaultConstruct(mHasher(key), key).mValue;
+    }
+    const size_t index = KeyScan::template Find<N>(GetKeys(), mInlineSize, key);
+    if (index < mInlineSize)
+    {
+        return GetValues()[index];
+    }
+    return InsertAbsent(key, Value());
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+template <typename Function>
+void SmallHashMap<Key, Value, N, Hasher>::ForEach(Function&& function) const
+{
+    if (mTable)
+    {
+        for (const auto& keyValuePair : *mTable)
+        {
+            function(keyValuePair.mKey, keyValuePair.mValue);
+        }
+        return;
+    }
+    for (size_t i = 0; i < mInlineSize; ++i)
+    {
+        function(GetKeys()[i], GetValues()[i]);
+    }
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+size_t SmallHashMap<Key, Value, N, Hasher>::Size() const noexcept
+{
+    return mTable ? mTable->Size() : mInlineSize;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+bool SmallHashMap<Key, Value, N, Hasher>::Empty() const noexcept
+{
+    return Size() == 0;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+bool SmallHashMap<Key, Value, N, Hasher>::IsInline() const noexcept
+{
+    return !mTable;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+Key* SmallHashMap<Key, Value, N, Hasher>::GetKeys()
+{
+    return reinterpret_cast<Key*>(mKeys);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+const Key* SmallHashMap<Key, Value, N, Hasher>::GetKeys() const
+{
+    return reinterpret_cast<const Key*>(mKeys);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+Value* SmallHashMap<Key, Value, N, Hasher>::GetValues()
+{
+    return reinterpret_cast<Value*>(mValues);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+const Value* SmallHashMap<Key, Value, N, Hasher>::GetValues() const
+{
+    return reinterpret_cast<const Value*>(mValues);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+Value& SmallHashMap<Key, Value, N, Hasher>::InsertAbsent(const Key& key, const Value& value)
+{
+    if (mInlineSize == N)
+    {
+        MoveToTable();
+        const size_t hash = mHasher(key);
+        mTable->Insert(hash, KeyValuePair{key, value});
+        return mTable->Find(hash, key)->mValue;
+    }
+    new (GetKeys() + mInlineSize) Key(key);
+    Value* slot = new (GetValues() + mInlineSize) Value(value);
+    ++mInlineSize;
+    return *slot;
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+void SmallHashMap<Key, Value, N, Hasher>::MoveToTable()
+{
+    auto table = std::make_unique<CollisionHandlerType>(2 * N, KeyValuePairHasher{mHasher});
+    for (size_t i = 0; i < mInlineSize; ++i)
+    {
+        const size_t hash = mHasher(GetKeys()[i]);
+        table->Insert(hash, KeyValuePair{std::move(GetKeys()[i]), std::move(GetValues()[i])});
+    }
+    DestroyInline();
+    mTable = std::move(table);
+}
+
+template <typename Key, typename Value, size_t N, typename Hasher>
+void SmallHashMap<Key, Value, N, Hasher>::DestroyInline()
+{
+    for (size_t i = 0; i < mInlineSize; ++i)
+    {
+        GetKeys()[i].~Key();
+        GetValues()[i].~Value();
+    }
+    mInlineSize = 0;
+}
+
+// Expects this to be empty and inline
+template <typename Key, typename Value, size_t N, typename Hasher>
+void SmallHashMap<Key, Value, N, Hasher>::CopyFrom(const SmallHashMap& other)
+{
+    if (other.mTable)
+    {
+        mTable = std::make_unique<CollisionHandlerType>(*other.mTable);
+        return;
+    }
+    for (size_t i = 0; i < other.mInlineSize; ++i)
+    {
+        new (GetKeys() + i) Key(other.GetKeys()[i]);
+        new (GetValues() + i) Value(other.GetValues()[i]);
+        // Counted one by one so a throwing copy leaves nothing behind
+        ++mInlineSize;
+    }
+}
+
+// Expects this to be empty and inline, leaves other empty and inline
+template <typename Key, typename Value, size_t N, typename Hasher>
+void SmallHashMap<Key, Value, N, Hasher>::MoveFrom(SmallHashMap& other)
+{
+    mTable = std::move(other.mTable);
+    for (size_t i = 0; i < other.mInlineSize; ++i)
+    {
+        new (GetKeys() + i) Key(std::move(other.GetKeys()[i]));
+        new (GetValues() + i) Value(std::move(other.GetValues()[i]));
+    }
+    mInlineSize = other.mInlineSize;
+    other.DestroyInline();
+}
+
+}  // namespace Moon
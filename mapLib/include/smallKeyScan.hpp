@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace Moon
+{
+
+// Linear search through a short array of keys. Integer, enum and pointer
+// keys of 4 or 8 bytes compare equal exactly when their bytes do, so with
+// SSE2 they are matched 16 bytes at a time. Any other key is compared one
+// by one with ==.
+template <typename Key>
+class SmallKeyScan
+{
+   public:
+    static constexpr size_t CHUNK_SIZE = 16;
+    // Alignment of the keys that lets every chunk load stay within one
+    // cache line
+    static constexpr size_t ALIGNMENT = CHUNK_SIZE > alignof(Key) ? CHUNK_SIZE : alignof(Key);
+    static constexpr bool VECTORIZED =
+#ifdef __SSE2__
+        (std::is_integral_v<Key> || std::is_enum_v<Key> || std::is_pointer_v<Key>) &&
+        (sizeof(Key) == 4 || sizeof(Key) == 8);
+#else
+        false;
+#endif
+
+    // Bytes to reserve for capacity keys, the vectorised scan reads whole
+    // chunks and may look past the last key
+    static constexpr size_t GetStorageSize(const size_t capacity)
+    {
+        return (capacity * sizeof(Key) + CHUNK_SIZE - 1) / CHUNK_SIZE * CHUNK_SIZE;
+    }
+
+    // Index of key among the first count keys, count if it is absent. keys
+    // must point to GetStorageSize(CAPACITY) readable bytes, ALIGNMENT
+    // aligned. The vectorised scan reads all of them whatever count is and
+    // does not branch on where or whether the key matched, which half the
+    // lookups of a typical caller miss would make a coin toss.
+    template <size_t CAPACITY>
+    static size_t Find(const Key* keys, const size_t count, const Key& key)
+    {
+#ifdef __SSE2__
+        if constexpr (VECTORIZED)
+        {
+            constexpr size_t CHUNK_COUNT = GetStorageSize(CAPACITY) / CHUNK_SIZE;
+            // One mask bit per 32 bit lane, four per chunk
+            constexpr size_t LANES_PER_KEY = sizeof(Key) / sizeof(int32_t);
+            constexpr size_t CHUNKS_PER_MASK = 8;
+            constexpr size_t KEYS_PER_MASK = CHUNKS_PER_MASK * CHUNK_SIZE / sizeof(Key);
+            // Set past the lanes of a mask so that no match reads as index
+            // KEYS_PER_MASK
+            constexpr uint64_t NO_MATCH_BIT = uint64_t{1} << (CHUNKS_PER_MASK * 4);
+
+            __m128i needle;
+            if constexpr (sizeof(Key) == 4)
+            {
+                int32_t bits;
+                std::memcpy(&bits, &key, sizeof(bits));
+                needle = _mm_set1_epi32(bits);
+            }
+            else
+            {
+                int64_t bits;
+                std::memcpy(&bits, &key, sizeof(bits));
+                needle = _mm_set1_epi64x(bits);
+            }
+
+            const __m128i* chunks = reinterpret_cast<const __m128i*>(keys);
+            for (size_t first = 0; first < CHUNK_COUNT; first += CHUNKS_PER_MASK)
+            {
+                uint64_t mask = NO_MATCH_BIT;
+                for (size_t chunk = first; chunk < first + CHUNKS_PER_MASK && chunk < CHUNK_COUNT;
+                     ++chunk)
+                {
+                    __m128i equal = _mm_cmpeq_epi32(_mm_load_si128(chunks + chunk), needle);
+                    if constexpr (sizeof(Key) == 8)
+                    {
+                        // A key matches when both of its halves do
+                        equal = _mm_and_si128(equal,
+                                              _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+                    }
+                    const auto chunkMask =
+                        static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+                    mask |= chunkMask << (4 * (chunk - first));
+                }
+                // Slots past count hold stale keys or zeroes
+                const size_t index =
+                    first / CHUNKS_PER_MASK * KEYS_PER_MASK +
+                    static_cast<size_t>(__builtin_ctzll(mask)) / LANES_PER_KEY;
+                if (mask != NO_MATCH_BIT || first + CHUNKS_PER_MASK >= CHUNK_COUNT)
+                {
+                    return index < count ? index : count;
+                }
+            }
+            return count;
+        }
+#endif
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (keys[i] == key)
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+};
+}  // namespace Moon
@@ -0,0 +1 @@
+#include <MapLib/lruCache.hpp>
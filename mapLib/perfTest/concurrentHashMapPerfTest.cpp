@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <HashLib/hashing.hpp>
+#include <MapLib/concurrentHashMap.hpp>
+#include <MapLib/hashMap.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+static constexpr uint64_t KEY_COUNT = 1 << 20;
+// One operation in WRITE_PERIOD is a write, the rest are reads
+static constexpr uint64_t WRITE_PERIOD = 20;
+
+// Baseline: a single HashMap behind a reader-writer lock
+static Moon::HashMap<uint64_t, uint64_t>* lockedMap = nullptr;
+static std::shared_mutex lockedMapMutex;
+
+static Moon::ConcurrentHashMap<uint64_t, uint64_t>* concurrentMap = nullptr;
+
+// Cheap per-thread key stream, the generator must not dominate the lookups
+static uint64_t NextKey(uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state % KEY_COUNT;
+}
+
+static void BM_SharedMutexHashMapReadMostly(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        lockedMap = new Moon::HashMap<uint64_t, uint64_t>();
+        for (uint64_t key = 0; key < KEY_COUNT; ++key)
+        {
+            lockedMap->Insert(key, key);
+        }
+    }
+
+    uint64_t rng = Moon::Util::Hashing::FIBONACCI_MULTIPLIER * (state.thread_index() + 1);
+    uint64_t operation = 0;
+    uint64_t sum = 0;
+    for (auto _ : state)
+    {
+        const uint64_t key = NextKey(rng);
+        if (++operation % WRITE_PERIOD == 0)
+        {
+            std::unique_lock<std::shared_mutex> lock(lockedMapMutex);
+            lockedMap->Insert(key, operation);
+        }
+        else
+        {
+            std::shared_lock<std::shared_mutex> lock(lockedMapMutex);
+            const auto it = lockedMap->Find(key);
+            sum += it == lockedMap->End() ? 0 : it->mValue;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        delete lockedMap;
+    }
+}
+
+static void BM_ConcurrentHashMapReadMostly(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        concurrentMap = new Moon::ConcurrentHashMap<uint64_t, uint64_t>();
+        for (uint64_t key = 0; key < KEY_COUNT; ++key)
+        {
+            concurrentMap->Insert(key, key);
+        }
+    }
+
+    uint64_t rng = Moon::Util::Hashing::FIBONACCI_MULTIPLIER * (state.thread_index() + 1);
+    uint64_t operation = 0;
+    uint64_t sum = 0;
+    for (auto _ : state)
+    {
+        const uint64_t key = NextKey(rng);
+        if (++operation % WRITE_PERIOD == 0)
+        {
+            concurrentMap->Insert(key, operation);
+        }
+        else
+        {
+            uint64_t value = 0;
+            concurrentMap->Find(key, value);
+            sum += value;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        delete concurrentMap;
+    }
+}
+
+BENCHMARK(BM_SharedMutexHashMapReadMostly)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentHashMapReadMostly)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,251 @@
+#include <benchmark/benchmark.h>
+
+#include <MapLib/constexprMap.hpp>
+#include <MapLib/hashMap.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <vector>
+
+enum class Opcode
+{
+    Nop,
+    Load,
+    Store,
+    Move,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    And,
+    Or,
+    Xor,
+    Shift,
+    Compare,
+    Jump,
+    Call,
+    Return,
+};
+
+static constexpr int OPCODE_COUNT = 16;
+
+static constexpr std::pair<Opcode, int> OPCODE_COSTS[] = {
+    {Opcode::Nop, 1},     {Opcode::Load, 4},  {Opcode::Store, 4},   {Opcode::Move, 1},
+    {Opcode::Add, 1},     {Opcode::Sub, 1},   {Opcode::Mul, 3},     {Opcode::Div, 20},
+    {Opcode::And, 1},     {Opcode::Or, 1},    {Opcode::Xor, 1},     {Opcode::Shift, 1},
+    {Opcode::Compare, 1}, {Opcode::Jump, 2},  {Opcode::Call, 5},    {Opcode::Return, 5},
+};
+
+static constexpr std::pair<std::string_view, int> KEYWORDS[] = {
+    {"break", 0},   {"case", 1},     {"const", 2},   {"continue", 3},  {"default", 4},
+    {"do", 5},      {"else", 6},     {"enum", 7},    {"for", 8},       {"goto", 9},
+    {"if", 10},     {"return", 11},  {"sizeof", 12}, {"static", 13},   {"struct", 14},
+    {"switch", 15}, {"typedef", 16}, {"union", 17},  {"volatile", 18}, {"while", 19},
+};
+
+static constexpr auto OPCODE_MAP = Moon::ConstexprMap<Opcode, int, OPCODE_COUNT>(OPCODE_COSTS);
+static constexpr auto KEYWORD_MAP = Moon::MakeConstexprMap(KEYWORDS);
+
+static constexpr size_t LOOKUPS_PER_ITERATION = 4096;
+
+static int OpcodeCostSwitch(const Opcode opcode)
+{
+    switch (opcode)
+    {
+        case Opcode::Nop:
+        case Opcode::Move:
+        case Opcode::Add:
+        case Opcode::Sub:
+        case Opcode::And:
+        case Opcode::Or:
+        case Opcode::Xor:
+        case Opcode::Shift:
+        case Opcode::Compare:
+            return 1;
+        case Opcode::Jump:
+            return 2;
+        case Opcode::Mul:
+            return 3;
+        case Opcode::Load:
+        case Opcode::Store:
+            return 4;
+        case Opcode::Call:
+        case Opcode::Return:
+            return 5;
+        case Opcode::Div:
+            return 20;
+    }
+    return 0;
+}
+
+// What a keyword table written by hand usually looks like, a switch on the
+// length and then comparisons
+static int KeywordSwitch(const std::string_view word)
+{
+    switch (word.size())
+    {
+        case 2:
+            return word == "do" ? 5 : word == "if" ? 10 : -1;
+        case 3:
+            return word == "for" ? 8 : -1;
+        case 4:
+            return word == "case" ? 1 : word == "else" ? 6 : word == "enum" ? 7 : word == "goto" ? 9 : -1;
+        case 5:
+            return word == "break"   ? 0
+                   : word == "const" ? 2
+                   : word == "union" ? 17
+                   : word == "while" ? 19
+                                     : -1;
+        case 6:
+            return word == "return"   ? 11
+                   : word == "sizeof" ? 12
+                   : word == "static" ? 13
+                   : word == "struct" ? 14
+                   : word == "switch" ? 15
+                                      : -1;
+        case 7:
+            return word == "default" ? 4 : word == "typedef" ? 16 : -1;
+        case 8:
+            return word == "continue" ? 3 : word == "volatile" ? 18 : -1;
+        default:
+            return -1;
+    }
+}
+
+static std::vector<Opcode> MakeOpcodes()
+{
+    std::mt19937 rng(1);
+    std::vector<Opcode> opcodes(LOOKUPS_PER_ITERATION);
+    for (auto& opcode : opcodes)
+    {
+        opcode = static_cast<Opcode>(rng() % OPCODE_COUNT);
+    }
+    return opcodes;
+}
+
+// Three keywords for every identifier that is not one
+static std::vector<std::string_view> MakeWords()
+{
+    static constexpr std::string_view IDENTIFIERS[] = {"i", "count", "buffer", "next", "values",
+                                                       "result", "do_it", "iffy"};
+    std::mt19937 rng(2);
+    std::vector<std::string_view> words(LOOKUPS_PER_ITERATION);
+    for (auto& word : words)
+    {
+        word = rng() % 4 == 0 ? IDENTIFIERS[rng() % std::size(IDENTIFIERS)]
+                              : KEYWORDS[rng() % std::size(KEYWORDS)].first;
+    }
+    return words;
+}
+
+static void BM_OpcodeConstexprMap(benchmark::State& state)
+{
+    const auto opcodes = MakeOpcodes();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const auto opcode : opcodes)
+        {
+            sum += *OPCODE_MAP.Find(opcode);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+static void BM_OpcodeHashMap(benchmark::State& state)
+{
+    const auto opcodes = MakeOpcodes();
+    Moon::HashMap<Opcode, int> map;
+    for (const auto& [opcode, cost] : OPCODE_COSTS)
+    {
+        map.Insert(opcode, cost);
+    }
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const auto opcode : opcodes)
+        {
+            sum += map.Find(opcode)->mValue;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+static void BM_OpcodeSwitch(benchmark::State& state)
+{
+    const auto opcodes = MakeOpcodes();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const auto opcode : opcodes)
+        {
+            sum += OpcodeCostSwitch(opcode);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+static void BM_KeywordConstexprMap(benchmark::State& state)
+{
+    const auto words = MakeWords();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const auto word : words)
+        {
+            const int* value = KEYWORD_MAP.Find(word);
+            sum += value ? *value : -1;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+static void BM_KeywordHashMap(benchmark::State& state)
+{
+    const auto words = MakeWords();
+    Moon::HashMap<std::string_view, int> map;
+    for (const auto& [keyword, value] : KEYWORDS)
+    {
+        map.Insert(keyword, value);
+    }
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const auto word : words)
+        {
+            const auto it = map.Find(word);
+            sum += it != map.End() ? it->mValue : -1;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+static void BM_KeywordSwitch(benchmark::State& state)
+{
+    const auto words = MakeWords();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const auto word : words)
+        {
+            sum += KeywordSwitch(word);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+BENCHMARK(BM_OpcodeConstexprMap);
+BENCHMARK(BM_OpcodeHashMap);
+BENCHMARK(BM_OpcodeSwitch);
+BENCHMARK(BM_KeywordConstexprMap);
+BENCHMARK(BM_KeywordHashMap);
+BENCHMARK(BM_KeywordSwitch);
+
+BENCHMARK_MAIN();
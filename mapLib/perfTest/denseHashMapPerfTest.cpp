@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <MapLib/denseHashMap.hpp>
+#include <MapLib/hashMap.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <malloc.h>
+#include <random>
+#include <vector>
+
+using DenseMap = Moon::DenseHashMap<uint64_t, uint64_t>;
+using LinearMap =
+    Moon::HashMap<uint64_t, uint64_t, Moon::Hash<uint64_t>, Moon::OpenAddressingCollisionHandler>;
+using SwissMap = Moon::HashMap<uint64_t, uint64_t>;
+
+// Bytes malloc has handed out and not taken back, the tables come from
+// HeapAllocator which does not go through operator new. The large ones are
+// mapped on their own and only show up in hblkhd.
+static size_t GetHeapBytes()
+{
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+// From the first level cache to well past the last one
+static void SizeArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+}
+
+static std::vector<uint64_t> MakeKeys(const size_t size)
+{
+    std::mt19937_64 rng(size);
+    std::vector<uint64_t> keys(size);
+    for (auto& key : keys)
+    {
+        key = rng();
+    }
+    return keys;
+}
+
+template <typename Map>
+static void BM_Iterate(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0));
+    const size_t heapBefore = GetHeapBytes();
+    Map map;
+    for (const uint64_t key : keys)
+    {
+        map.Insert(key, key);
+    }
+    const size_t bytesPerKey = (GetHeapBytes() - heapBefore) / keys.size();
+
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (const auto& entry : map)
+        {
+            sum += entry.mValue;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+    state.counters["bytesPerKey"] = static_cast<double>(bytesPerKey);
+}
+
+template <typename Map>
+static void BM_FindHit(benchmark::State& state)
+{
+    auto keys = MakeKeys(state.range(0));
+    Map map;
+    for (const uint64_t key : keys)
+    {
+        map.Insert(key, key);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(0));
+
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(map.Find(keys[next])->mValue);
+        next = next + 1 == keys.size() ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+static void BM_Erase(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Map map;
+        for (const uint64_t key : keys)
+        {
+            map.Insert(key, key);
+        }
+        state.ResumeTiming();
+        for (const uint64_t key : keys)
+        {
+            map.Delete(key);
+        }
+        benchmark::DoNotOptimize(map.Size());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK_TEMPLATE(BM_Iterate, DenseMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_Iterate, LinearMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_Iterate, SwissMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, DenseMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, LinearMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, SwissMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_Erase, DenseMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_Erase, LinearMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_Erase, SwissMap)->Apply(SizeArguments);
+
+BENCHMARK_MAIN();
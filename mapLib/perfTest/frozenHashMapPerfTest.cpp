@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <MapLib/frozenHashMap.hpp>
+#include <MapLib/hashMap.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using LinearMap =
+    Moon::HashMap<uint64_t, uint64_t, Moon::Hash<uint64_t>, Moon::OpenAddressingCollisionHandler>;
+using SwissMap = Moon::HashMap<uint64_t, uint64_t>;
+using FrozenMap = Moon::FrozenHashMap<uint64_t, uint64_t>;
+
+// From cache resident up to several times a typical last level cache
+static void SizeArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 23);
+}
+
+static std::vector<uint64_t> MakeKeys(const size_t count)
+{
+    std::mt19937_64 rng(count);
+    std::vector<uint64_t> keys(count);
+    for (auto& key : keys)
+    {
+        key = rng();
+    }
+    return keys;
+}
+
+template <typename Map>
+static Map MakeMap(const std::vector<uint64_t>& keys)
+{
+    Map map;
+    for (const auto key : keys)
+    {
+        map.Insert(key, key);
+    }
+    return map;
+}
+
+template <>
+FrozenMap MakeMap<FrozenMap>(const std::vector<uint64_t>& keys)
+{
+    return FrozenMap(MakeMap<LinearMap>(keys));
+}
+
+template <typename Map>
+static const uint64_t* FindValue(Map& map, const uint64_t key)
+{
+    const auto it = map.Find(key);
+    return it == map.End() ? nullptr : &it->mValue;
+}
+
+static const uint64_t* FindValue(FrozenMap& map, const uint64_t key)
+{
+    return map.Find(key);
+}
+
+// Slots plus one control or state byte per slot of the table a HashMap
+// with these keys ends up with. The keys are inserted in their original
+// order, inserting them in the table order of the map makes linear probing
+// cluster badly while the new table grows.
+template <typename Map>
+static size_t GetByteSize(const Map&, const std::vector<uint64_t>& keys)
+{
+    typename Map::CollisionHandlerType collisionHandler;
+    for (const auto key : keys)
+    {
+        collisionHandler.Insert(Moon::Hash<uint64_t>()(key), {key, key});
+    }
+    return collisionHandler.Capacity() * (sizeof(typename Map::KeyValuePair) + 1);
+}
+
+static size_t GetByteSize(const FrozenMap& map, const std::vector<uint64_t>&)
+{
+    return map.ByteSize();
+}
+
+static constexpr size_t LOOKUPS_PER_ITERATION = 1 << 14;
+
+// Present keys in random order
+template <typename Map>
+static void BM_FindHit(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0));
+    auto map = MakeMap<Map>(keys);
+    auto lookups = keys;
+    std::shuffle(lookups.begin(), lookups.end(), std::mt19937_64(42));
+    size_t offset = 0;
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < LOOKUPS_PER_ITERATION; ++i)
+        {
+            sum += *FindValue(map, lookups[(offset + i) % lookups.size()]);
+        }
+        benchmark::DoNotOptimize(sum);
+        offset = (offset + LOOKUPS_PER_ITERATION) % lookups.size();
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+    state.counters["bytesPerKey"] =
+        static_cast<double>(GetByteSize(map, keys)) / static_cast<double>(keys.size());
+}
+
+static void BM_Build(benchmark::State& state)
+{
+    const auto map = MakeMap<LinearMap>(MakeKeys(state.range(0)));
+    for (auto _ : state)
+    {
+        const FrozenMap frozen(map);
+        benchmark::DoNotOptimize(frozen.Begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_FindHit, LinearMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, SwissMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, FrozenMap)->Apply(SizeArguments);
+BENCHMARK(BM_Build)->Apply(SizeArguments)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
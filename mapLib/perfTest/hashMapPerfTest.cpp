@@ -0,0 +1,175 @@
+#include <benchmark/benchmark.h>
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <MapLib/hashMap.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using MoonMap = Moon::HashMap<uint64_t, uint64_t>;
+using MoonLinearMap =
+    Moon::HashMap<uint64_t, uint64_t, std::hash<uint64_t>, Moon::OpenAddressingCollisionHandler>;
+using StdMap = std::unordered_map<uint64_t, uint64_t>;
+
+static void SizeArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 18)->Arg(1 << 21);
+}
+
+// Distinct random keys, the odd ones present and the even ones missing
+static std::vector<uint64_t> MakeKeys(const size_t count, const bool present)
+{
+    std::mt19937_64 rng(count);
+    std::vector<uint64_t> keys(count);
+    for (auto& key : keys)
+    {
+        key = (rng() & ~1ull) | (present ? 1 : 0);
+    }
+    return keys;
+}
+
+template <typename Map>
+static const uint64_t* FindValue(Map& map, const uint64_t key)
+{
+    const auto it = map.Find(key);
+    return it == map.End() ? nullptr : &it->mValue;
+}
+
+static const uint64_t* FindValue(StdMap& map, const uint64_t key)
+{
+    const auto it = map.find(key);
+    return it == map.end() ? nullptr : &it->second;
+}
+
+template <typename Map>
+static Map MakeMap(const std::vector<uint64_t>& keys)
+{
+    Map map;
+    for (const auto key : keys)
+    {
+        map[key] = key;
+    }
+    return map;
+}
+
+template <typename Map>
+static void BM_Insert(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0), true);
+    for (auto _ : state)
+    {
+        Map map;
+        for (const auto key : keys)
+        {
+            map[key] = key;
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map>
+static void BM_FindHit(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0), true);
+    auto map = MakeMap<Map>(keys);
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (const auto key : keys)
+        {
+            sum += *FindValue(map, key);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map>
+static void BM_FindMiss(benchmark::State& state)
+{
+    auto map = MakeMap<Map>(MakeKeys(state.range(0), true));
+    const auto missingKeys = MakeKeys(state.range(0), false);
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (const auto key : missingKeys)
+        {
+            found += FindValue(map, key) != nullptr;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Tables from cache resident up to several times the size of a typical 32 MB
+// last level cache, where every lookup is a DRAM miss
+static void LargeSizeArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 24);
+}
+
+// Present keys in random order
+static std::vector<uint64_t> ShuffledKeys(std::vector<uint64_t> keys)
+{
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+    return keys;
+}
+
+static constexpr size_t LOOKUPS_PER_ITERATION = 1 << 14;
+
+static void BM_FindLoop(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0), true);
+    auto map = MakeMap<MoonMap>(keys);
+    const auto lookups = ShuffledKeys(keys);
+    std::vector<MoonMap::IteratorType> results(LOOKUPS_PER_ITERATION);
+    size_t offset = 0;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < LOOKUPS_PER_ITERATION; ++i)
+        {
+            results[i] = map.Find(lookups[(offset + i) % lookups.size()]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        offset = (offset + LOOKUPS_PER_ITERATION) % lookups.size();
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+static void BM_FindBatch(benchmark::State& state)
+{
+    const auto keys = MakeKeys(state.range(0), true);
+    auto map = MakeMap<MoonMap>(keys);
+    auto lookups = ShuffledKeys(keys);
+    // Wraps around like the single lookups without a modulo per key
+    lookups.insert(lookups.end(), lookups.begin(),
+                   lookups.begin() + std::min(lookups.size(), LOOKUPS_PER_ITERATION));
+    std::vector<MoonMap::IteratorType> results(LOOKUPS_PER_ITERATION);
+    size_t offset = 0;
+    for (auto _ : state)
+    {
+        const size_t count = std::min(LOOKUPS_PER_ITERATION, lookups.size() - offset);
+        map.FindBatch(lookups.data() + offset, count, results.data());
+        benchmark::DoNotOptimize(results.data());
+        offset = (offset + count) % keys.size();
+    }
+    state.SetItemsProcessed(state.iterations() * LOOKUPS_PER_ITERATION);
+}
+
+BENCHMARK_TEMPLATE(BM_Insert, MoonMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_Insert, MoonLinearMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_Insert, StdMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, MoonMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, MoonLinearMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindHit, StdMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindMiss, MoonMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindMiss, MoonLinearMap)->Apply(SizeArguments);
+BENCHMARK_TEMPLATE(BM_FindMiss, StdMap)->Apply(SizeArguments);
+BENCHMARK(BM_FindLoop)->Apply(LargeSizeArguments);
+BENCHMARK(BM_FindBatch)->Apply(LargeSizeArguments);
+
+BENCHMARK_MAIN();
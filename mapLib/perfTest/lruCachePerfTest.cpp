@@ -0,0 +1,161 @@
+#include <benchmark/benchmark.h>
+
+#include <HashLib/hashing.hpp>
+#include <MapLib/lruCache.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+static constexpr uint64_t KEY_COUNT = 1 << 20;
+// The cache holds a tenth of the keys
+static constexpr uint64_t CACHED_KEYS = KEY_COUNT / 10;
+static constexpr size_t SAMPLE_COUNT = 1 << 22;
+// Skew of the key popularity, close to what web and storage traces show
+static constexpr double ZIPF_EXPONENT = 0.99;
+
+using Cache = Moon::LruCache<uint64_t, uint64_t>;
+
+// What the hand written caches usually look like, one mutex around a map to
+// list iterators
+class StdLruCache
+{
+   public:
+    explicit StdLruCache(const size_t capacity) : mCapacity(capacity) {}
+
+    bool Find(const uint64_t key, uint64_t& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const auto it = mIndex.find(key);
+        if (it == mIndex.end())
+        {
+            return false;
+        }
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        value = it->second->second;
+        return true;
+    }
+
+    void Insert(const uint64_t key, const uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const auto it = mIndex.find(key);
+        if (it != mIndex.end())
+        {
+            it->second->second = value;
+            mEntries.splice(mEntries.begin(), mEntries, it->second);
+            return;
+        }
+        if (mIndex.size() == mCapacity)
+        {
+            mIndex.erase(mEntries.back().first);
+            mEntries.pop_back();
+        }
+        mEntries.emplace_front(key, value);
+        mIndex.emplace(key, mEntries.begin());
+    }
+
+   private:
+    const size_t mCapacity;
+    std::mutex mMutex;
+    std::list<std::pair<uint64_t, uint64_t>> mEntries;
+    std::unordered_map<uint64_t, std::list<std::pair<uint64_t, uint64_t>>::iterator> mIndex;
+};
+
+// Keys drawn from a Zipf distribution by inverting its cumulative
+// distribution, the popular keys are scattered over the key space
+static const std::vector<uint64_t>& GetSamples()
+{
+    static const std::vector<uint64_t> samples = []() {
+        std::vector<double> cumulative(KEY_COUNT);
+        double sum = 0;
+        for (uint64_t rank = 0; rank < KEY_COUNT; ++rank)
+        {
+            sum += 1.0 / std::pow(static_cast<double>(rank + 1), ZIPF_EXPONENT);
+            cumulative[rank] = sum;
+        }
+        std::mt19937_64 rng(1);
+        std::uniform_real_distribution<double> uniform(0, sum);
+        std::vector<uint64_t> keys(SAMPLE_COUNT);
+        for (auto& key : keys)
+        {
+            const auto rank = static_cast<uint64_t>(
+                std::lower_bound(cumulative.begin(), cumulative.end(), uniform(rng)) -
+                cumulative.begin());
+            key = Moon::Util::Hashing::FibonacciMultiply(rank);
+        }
+        return keys;
+    }();
+    return samples;
+}
+
+static Cache* cache = nullptr;
+static StdLruCache* stdCache = nullptr;
+
+// Every thread reads through the cache and fills it on a miss. target is
+// only read inside the loop, thread 0 may still be creating the cache before.
+template <typename CacheType>
+static void RunWorkload(benchmark::State& state, CacheType* const& target)
+{
+    const auto& samples = GetSamples();
+    size_t next = state.thread_index() * (SAMPLE_COUNT / 8);
+    uint64_t hits = 0;
+    uint64_t lookups = 0;
+    for (auto _ : state)
+    {
+        const uint64_t key = samples[next];
+        next = next + 1 == SAMPLE_COUNT ? 0 : next + 1;
+        uint64_t value = 0;
+        if (target->Find(key, value))
+        {
+            ++hits;
+        }
+        else
+        {
+            target->Insert(key, key);
+        }
+        ++lookups;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["hitRatio"] = benchmark::Counter(static_cast<double>(hits) / lookups,
+                                                    benchmark::Counter::kAvgThreads);
+}
+
+static void BM_LruCacheZipf(benchmark::State& state)
+{
+    GetSamples();
+    if (state.thread_index() == 0)
+    {
+        cache = new Cache(CACHED_KEYS * Cache::DEFAULT_ENTRY_BYTES);
+    }
+    RunWorkload(state, cache);
+    if (state.thread_index() == 0)
+    {
+        delete cache;
+    }
+}
+
+static void BM_StdLruCacheZipf(benchmark::State& state)
+{
+    GetSamples();
+    if (state.thread_index() == 0)
+    {
+        stdCache = new StdLruCache(CACHED_KEYS);
+    }
+    RunWorkload(state, stdCache);
+    if (state.thread_index() == 0)
+    {
+        delete stdCache;
+    }
+}
+
+BENCHMARK(BM_LruCacheZipf)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_StdLruCacheZipf)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
+#include <MapLib/hashMap.hpp>
+#include <MapLib/smallHashMap.hpp>
+
+#include <cstdint>
+#include <malloc.h>
+#include <random>
+#include <vector>
+
+using SmallMap = Moon::SmallHashMap<uint64_t, uint64_t, 8>;
+using LinearMap =
+    Moon::HashMap<uint64_t, uint64_t, Moon::Hash<uint64_t>, Moon::OpenAddressingCollisionHandler>;
+using SwissMap = Moon::HashMap<uint64_t, uint64_t>;
+
+// Enough maps that they do not all fit in the first level caches, like the
+// per object maps of a real program
+static constexpr size_t MAP_COUNT = 4096;
+
+// Bytes malloc has handed out and not taken back, the tables come from
+// HeapAllocator which does not go through operator new
+static size_t GetHeapBytes()
+{
+    return mallinfo2().uordblks;
+}
+
+// Both sides of the eight inline entries of SmallMap
+static void EntryArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(1)->Arg(4)->Arg(8)->Arg(16);
+}
+
+static std::vector<uint64_t> MakeKeys(const size_t entries)
+{
+    std::mt19937_64 rng(entries);
+    std::vector<uint64_t> keys(MAP_COUNT * entries);
+    for (auto& key : keys)
+    {
+        key = rng();
+    }
+    return keys;
+}
+
+template <typename Map>
+static std::vector<Map> MakeMaps(const std::vector<uint64_t>& keys, const size_t entries)
+{
+    std::vector<Map> maps(MAP_COUNT);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        maps[i / entries].Insert(keys[i], keys[i]);
+    }
+    return maps;
+}
+
+template <typename Map>
+static const uint64_t* FindValue(Map& map, const uint64_t key)
+{
+    const auto it = map.Find(key);
+    return it == map.End() ? nullptr : &it->mValue;
+}
+
+static const uint64_t* FindValue(SmallMap& map, const uint64_t key)
+{
+    return map.Find(key);
+}
+
+// Every lookup goes to the next map, half of them for a key it holds
+template <typename Map>
+static void BM_Find(benchmark::State& state)
+{
+    const size_t entries = state.range(0);
+    const auto keys = MakeKeys(entries);
+    const size_t heapBefore = GetHeapBytes();
+    auto maps = MakeMaps<Map>(keys, entries);
+    // Includes the array of map objects
+    const size_t bytesPerMap = (GetHeapBytes() - heapBefore) / MAP_COUNT;
+
+    std::mt19937_64 rng(0);
+    std::vector<uint64_t> lookups(MAP_COUNT);
+    for (size_t i = 0; i < MAP_COUNT; ++i)
+    {
+        lookups[i] = rng() % 2 == 0 ? keys[i * entries + rng() % entries] : rng();
+    }
+
+    for (auto _ : state)
+    {
+        size_t found = 0;
+        for (size_t i = 0; i < MAP_COUNT; ++i)
+        {
+            found += FindValue(maps[i], lookups[i]) != nullptr;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * MAP_COUNT);
+    state.counters["bytesPerMap"] = static_cast<double>(bytesPerMap);
+}
+
+template <typename Map>
+static void BM_Build(benchmark::State& state)
+{
+    const size_t entries = state.range(0);
+    const auto keys = MakeKeys(entries);
+    for (auto _ : state)
+    {
+        auto maps = MakeMaps<Map>(keys, entries);
+        benchmark::DoNotOptimize(maps.data());
+    }
+    state.SetItemsProcessed(state.iterations() * MAP_COUNT);
+}
+
+BENCHMARK_TEMPLATE(BM_Find, SmallMap)->Apply(EntryArguments);
+BENCHMARK_TEMPLATE(BM_Find, LinearMap)->Apply(EntryArguments);
+BENCHMARK_TEMPLATE(BM_Find, SwissMap)->Apply(EntryArguments);
+BENCHMARK_TEMPLATE(BM_Build, SmallMap)->Apply(EntryArguments);
+BENCHMARK_TEMPLATE(BM_Build, LinearMap)->Apply(EntryArguments);
+BENCHMARK_TEMPLATE(BM_Build, SwissMap)->Apply(EntryArguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1 @@
+#include <MapLib/smallHashMap.hpp>
@@ -0,0 +1,200 @@
+#include <MapLib/concurrentHashMap.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Moon::Test
+{
+
+class ConcurrentHashMapFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+
+    static constexpr int THREAD_COUNT = 8;
+};
+
+// All words are always written together, a reader that sees them differ has
+// copied a value in the middle of a write
+struct Record
+{
+    uint64_t mWords[32];
+
+    bool IsConsistent() const
+    {
+        for (const auto word : mWords)
+        {
+            if (word != mWords[0])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(ConcurrentHashMapFixture, WHEN_used_from_one_thread_THEN_it_behaves_like_a_map)
+{
+    ConcurrentHashMap<int, int> map(10);
+    EXPECT_EQ(map.GetShardCount(), 16);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        map.Insert(i, i);
+    }
+    map.Insert(7, -7);
+    EXPECT_EQ(map.Size(), 1000);
+
+    int value = 0;
+    EXPECT_TRUE(map.Find(7, value));
+    EXPECT_EQ(value, -7);
+    EXPECT_FALSE(map.Find(1000, value));
+
+    EXPECT_TRUE(map.Delete(7));
+    EXPECT_FALSE(map.Delete(7));
+    EXPECT_FALSE(map.Contains(7));
+
+    map.Upsert(8, [](int& stored) { stored += 100; });
+    map.Upsert(2000, [](int& stored) { stored += 100; });
+    EXPECT_TRUE(map.Find(8, value));
+    EXPECT_EQ(value, 108);
+    EXPECT_TRUE(map.Find(2000, value));
+    EXPECT_EQ(value, 100);
+
+    map.Clear();
+    EXPECT_EQ(map.Size(), 0);
+    EXPECT_FALSE(map.Contains(8));
+}
+
+TEST_F(ConcurrentHashMapFixture, WHEN_upsert_function_throws_THEN_readers_see_later_writes_whole)
+{
+    ConcurrentHashMap<int, Record> map(1);
+    const auto fill = [](const uint64_t word) {
+        return [word](Record& record) {
+            for (auto& stored : record.mWords)
+            {
+                stored = word;
+            }
+        };
+    };
+    map.Upsert(1, fill(1));
+    EXPECT_THROW(map.Upsert(1,
+                            [](Record& record) {
+                                record.mWords[0] = 2;
+                                throw std::runtime_error("half written");
+                            }),
+                 std::runtime_error);
+    map.Upsert(1, fill(3));
+
+    // A reader waiting on an odd counter would never return here
+    Record record{};
+    EXPECT_TRUE(map.Find(1, record));
+    EXPECT_TRUE(record.IsConsistent());
+    EXPECT_EQ(record.mWords[0], 3);
+
+    // An absent key is inserted before function runs
+    EXPECT_THROW(map.Upsert(2, [](Record&) { throw std::runtime_error("not written"); }),
+                 std::runtime_error);
+    EXPECT_TRUE(map.Find(2, record));
+    EXPECT_EQ(record.mWords[0], 0);
+    EXPECT_EQ(map.Size(), 2);
+}
+
+TEST_F(ConcurrentHashMapFixture, WHEN_threads_upsert_the_same_keys_THEN_no_update_is_lost)
+{
+    ConcurrentHashMap<int, uint64_t> map(4);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back([&map] {
+            for (int i = 0; i < 20000; ++i)
+            {
+                map.Upsert(i % 500, [](uint64_t& count) { ++count; });
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(map.Size(), 500);
+    for (int key = 0; key < 500; ++key)
+    {
+        uint64_t count = 0;
+        ASSERT_TRUE(map.Find(key, count));
+        EXPECT_EQ(count, THREAD_COUNT * 40);
+    }
+}
+
+TEST_F(ConcurrentHashMapFixture, WHEN_readers_race_growing_writers_THEN_they_never_see_torn_values)
+{
+    ConcurrentHashMap<uint64_t, Record> map(2);
+    std::atomic<bool> writing{true};
+    std::atomic<uint64_t> tornReads{0};
+    std::atomic<uint64_t> hits{0};
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < THREAD_COUNT / 2; ++t)
+    {
+        readers.emplace_back([&] {
+            uint64_t key = 0;
+            while (writing.load(std::memory_order_relaxed))
+            {
+                Record record{};
+                if (map.Find(key++ % 50000, record))
+                {
+                    hits.fetch_add(1, std::memory_order_relaxed);
+                    if (!record.IsConsistent())
+                    {
+                        tornReads.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREAD_COUNT / 2; ++t)
+    {
+        writers.emplace_back([&map, t] {
+            for (uint64_t i = 0; i < 50000; ++i)
+            {
+                const uint64_t key = (i * 7 + static_cast<uint64_t>(t)) % 50000;
+                map.Upsert(key, [i](Record& record) {
+                    for (auto& word : record.mWords)
+                    {
+                        word = i;
+                    }
+                });
+                if (i % 3 == 0)
+                {
+                    map.Delete((key + 1) % 50000);
+                }
+            }
+        });
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    writing = false;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_GT(hits.load(), 0);
+    EXPECT_EQ(tornReads.load(), 0);
+}
+}  // namespace Moon::Test
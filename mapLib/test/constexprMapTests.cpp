@@ -0,0 +1,99 @@
+#include <MapLib/constexprMap.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace Moon::Test
+{
+
+enum class Opcode
+{
+    Load,
+    Store,
+    Add,
+    Sub,
+    Jump,
+    Halt,
+};
+
+static int Double(const int value)
+{
+    return value * 2;
+}
+
+static int Negate(const int value)
+{
+    return -value;
+}
+
+static constexpr auto KEYWORDS = MakeConstexprMap<std::string_view, int>({
+    {"break", 0},  {"case", 1},    {"const", 2},    {"continue", 3}, {"default", 4},
+    {"do", 5},     {"else", 6},    {"enum", 7},     {"for", 8},      {"goto", 9},
+    {"if", 10},    {"return", 11}, {"sizeof", 12},  {"static", 13},  {"struct", 14},
+    {"switch", 15}, {"typedef", 16}, {"union", 17}, {"volatile", 18}, {"while", 19},
+});
+
+// Laid out and looked up entirely at compile time
+static_assert(KEYWORDS.Size() == 20);
+static_assert(*KEYWORDS.Find("while") == 19);
+static_assert(KEYWORDS.Find("whale") == nullptr);
+
+class ConstexprMapFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+};
+
+TEST_F(ConstexprMapFixture, WHEN_string_keys_are_looked_up_THEN_each_finds_its_value)
+{
+    const std::string_view names[] = {"break",  "case",   "const",   "continue", "default",
+                                      "do",     "else",   "enum",    "for",      "goto",
+                                      "if",     "return", "sizeof",  "static",   "struct",
+                                      "switch", "typedef", "union",  "volatile", "while"};
+    for (int i = 0; i < 20; ++i)
+    {
+        const std::string name(names[i]);
+        ASSERT_NE(KEYWORDS.Find(name), nullptr) << name;
+        EXPECT_EQ(*KEYWORDS.Find(name), i);
+    }
+    EXPECT_FALSE(KEYWORDS.Contains(""));
+    EXPECT_FALSE(KEYWORDS.Contains("Break"));
+    EXPECT_FALSE(KEYWORDS.Contains("continues"));
+}
+
+TEST_F(ConstexprMapFixture, WHEN_enums_map_to_handlers_THEN_the_handler_is_called)
+{
+    static constexpr auto HANDLERS = MakeConstexprMap<Opcode, int (*)(int)>({
+        {Opcode::Load, &Double},
+        {Opcode::Add, &Negate},
+        {Opcode::Jump, &Double},
+    });
+    static_assert(HANDLERS.Contains(Opcode::Add));
+    static_assert(!HANDLERS.Contains(Opcode::Halt));
+
+    EXPECT_EQ((*HANDLERS.Find(Opcode::Load))(21), 42);
+    EXPECT_EQ((*HANDLERS.Find(Opcode::Add))(21), -21);
+    EXPECT_EQ(HANDLERS.Find(Opcode::Store), nullptr);
+}
+
+TEST_F(ConstexprMapFixture, WHEN_built_at_run_time_with_a_duplicate_THEN_it_throws)
+{
+    const std::pair<int, int> entries[] = {{1, 1}, {2, 2}, {1, 3}};
+    EXPECT_THROW((ConstexprMap<int, int, 3>(entries)), std::invalid_argument);
+
+    const std::pair<int, int> single[] = {{7, 70}};
+    const ConstexprMap<int, int, 1> map(single);
+    EXPECT_EQ(*map.Find(7), 70);
+    EXPECT_EQ(map.Find(8), nullptr);
+}
+
+}  // namespace Moon::Test
@@ -0,0 +1,213 @@
+#include <MapLib/denseHashMap.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Moon::Test
+{
+
+class DenseHashMapFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+
+    template <typename Key, typename Value>
+    static std::vector<Key> GetKeys(const DenseHashMap<Key, Value>& map)
+    {
+        std::vector<Key> keys;
+        for (const auto& entry : map)
+        {
+            keys.push_back(entry.mKey);
+        }
+        return keys;
+    }
+};
+
+// Every key lands on the same home slot
+struct ConstantHasher
+{
+    size_t operator()(int) const
+    {
+        return 0;
+    }
+};
+
+TEST_F(DenseHashMapFixture, WHEN_keys_are_inserted_THEN_iteration_follows_insertion_order)
+{
+    DenseHashMap<int, std::string> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Find(1), map.End());
+    EXPECT_FALSE(map.Delete(1));
+
+    const std::vector<int> keys{42, 7, 1000, -3, 0, 19};
+    for (const int key : keys)
+    {
+        map.Insert(key, std::to_string(key));
+    }
+    // Overwriting keeps the place of the key
+    map.Insert(7, "seven");
+    map[0] += "!";
+
+    EXPECT_EQ(map.Size(), keys.size());
+    EXPECT_EQ(GetKeys(map), keys);
+    EXPECT_EQ(map.Find(7)->mValue, "seven");
+    EXPECT_EQ(map.Find(0)->mValue, "0!");
+    EXPECT_EQ(map[5], "");
+    EXPECT_EQ(map.Size(), keys.size() + 1);
+}
+
+TEST_F(DenseHashMapFixture, WHEN_map_is_const_THEN_entries_are_read_only)
+{
+    using Map = DenseHashMap<int, std::string>;
+    using ConstEntry = std::remove_reference_t<decltype(*std::declval<const Map&>().Find(0))>;
+    using ConstIteratedEntry =
+        std::remove_reference_t<decltype(*std::declval<const Map&>().begin())>;
+    static_assert(std::is_const_v<ConstEntry>);
+    static_assert(std::is_const_v<ConstIteratedEntry>);
+
+    Map map;
+    map.Insert(1, "one");
+    map.Find(1)->mValue = "ONE";
+    const Map& constMap = map;
+    EXPECT_EQ(constMap.Find(1)->mValue, "ONE");
+    EXPECT_EQ(constMap.Find(2), constMap.End());
+    EXPECT_EQ(constMap.End() - constMap.Begin(), 1);
+}
+
+TEST_F(DenseHashMapFixture, WHEN_key_is_deleted_THEN_last_entry_takes_its_place)
+{
+    DenseHashMap<int, int> map;
+    for (int key = 0; key < 5; ++key)
+    {
+        map.Insert(key, key * 10);
+    }
+
+    EXPECT_TRUE(map.Delete(1));
+    EXPECT_FALSE(map.Delete(1));
+    EXPECT_EQ(GetKeys(map), (std::vector<int>{0, 4, 2, 3}));
+    // Deleting the last entry moves nothing
+    EXPECT_TRUE(map.Delete(3));
+    EXPECT_EQ(GetKeys(map), (std::vector<int>{0, 4, 2}));
+    EXPECT_EQ(map.Find(4)->mValue, 40);
+    EXPECT_FALSE(map.Contains(3));
+}
+
+TEST_F(DenseHashMapFixture, WHEN_keys_share_a_probe_run_THEN_deletes_keep_the_rest_reachable)
+{
+    DenseHashMap<int, int, ConstantHasher> map;
+    for (int key = 0; key < 10; ++key)
+    {
+        map.Insert(key, key);
+    }
+    for (const int key : {0, 5, 9, 3})
+    {
+        EXPECT_TRUE(map.Delete(key));
+        EXPECT_FALSE(map.Contains(key));
+    }
+
+    EXPECT_EQ(map.Size(), 6);
+    for (const int key : {1, 2, 4, 6, 7, 8})
+    {
+        EXPECT_EQ(map.Find(key)->mValue, key);
+    }
+}
+
+TEST_F(DenseHashMapFixture, WHEN_keys_are_inserted_and_deleted_at_random_THEN_map_matches_std_map)
+{
+    DenseHashMap<uint64_t, int> map;
+    std::map<uint64_t, int> expected;
+    uint32_t state = 1;
+    for (int i = 0; i < 20000; ++i)
+    {
+        state = state * 1664525 + 1013904223;
+        const uint64_t key = (state >> 12) % 600;
+        if ((state >> 4) % 3 == 0)
+        {
+            ASSERT_EQ(map.Delete(key), expected.erase(key) == 1);
+        }
+        else
+        {
+            map.Insert(key, i);
+            expected[key] = i;
+        }
+        if (i % 7000 == 0)
+        {
+            map.Clear();
+            expected.clear();
+        }
+        ASSERT_EQ(map.Size(), expected.size());
+    }
+
+    std::map<uint64_t, int> visited;
+    for (const auto& entry : map)
+    {
+        visited[entry.mKey] = entry.mValue;
+    }
+    EXPECT_EQ(visited, expected);
+    for (uint64_t key = 0; key < 600; ++key)
+    {
+        EXPECT_EQ(map.Contains(key), expected.count(key) == 1);
+    }
+}
+
+TEST_F(DenseHashMapFixture, WHEN_map_is_reserved_THEN_keys_stay_found_and_ordered)
+{
+    DenseHashMap<uint32_t, uint32_t> map;
+    map.Insert(3, 3);
+    map.Reserve(1000);
+    std::vector<uint32_t> keys{3};
+    for (uint32_t key = 100; key < 1100; ++key)
+    {
+        map.Insert(key, key);
+        keys.push_back(key);
+    }
+
+    EXPECT_EQ(GetKeys(map), keys);
+    for (const uint32_t key : keys)
+    {
+        ASSERT_EQ(map.Find(key)->mValue, key);
+    }
+}
+
+TEST_F(DenseHashMapFixture, WHEN_map_is_copied_or_moved_THEN_entries_follow)
+{
+    DenseHashMap<int, std::string> map;
+    for (int key = 0; key < 40; ++key)
+    {
+        map.Insert(key, std::to_string(key));
+    }
+
+    DenseHashMap<int, std::string> copy(map);
+    DenseHashMap<int, std::string> assigned;
+    assigned.Insert(-1, "gone");
+    assigned = map;
+    copy.Delete(0);
+    assigned.Insert(40, "40");
+    EXPECT_EQ(map.Size(), 40);
+    EXPECT_EQ(copy.Size(), 39);
+    EXPECT_FALSE(assigned.Contains(-1));
+    EXPECT_EQ(assigned.Find(39)->mValue, "39");
+
+    DenseHashMap<int, std::string> moved(std::move(map));
+    EXPECT_EQ(moved.Find(20)->mValue, "20");
+    EXPECT_TRUE(map.Empty());
+    EXPECT_FALSE(map.Contains(20));
+    // A moved from map takes new entries
+    map.Insert(1, "one");
+    EXPECT_EQ(map.Find(1)->mValue, "one");
+    moved = std::move(map);
+    EXPECT_EQ(moved.Size(), 1);
+}
+
+}  // namespace Moon::Test
@@ -0,0 +1,129 @@
+#include <MapLib/frozenHashMap.hpp>
+#include <MapLib/hashMap.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+namespace Moon::Test
+{
+
+class FrozenHashMapFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+        mPath = (std::filesystem::temp_directory_path() /
+                 ("moon_frozen_hash_map_" + std::to_string(getpid()) + ".bin"))
+                    .string();
+    }
+
+    void TearDown() override
+    {
+        std::remove(mPath.c_str());
+    }
+
+    std::string mPath;
+};
+
+TEST_F(FrozenHashMapFixture, WHEN_built_from_a_hash_map_THEN_every_key_is_found_once)
+{
+    HashMap<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+        map.Insert(i * 3, i);
+    }
+    const FrozenHashMap<uint64_t, uint64_t> frozen(map);
+    EXPECT_EQ(frozen.Size(), map.Size());
+
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+        const auto* value = frozen.Find(i * 3);
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, i);
+        EXPECT_FALSE(frozen.Contains(i * 3 + 1));
+    }
+
+    std::set<uint64_t> keys;
+    for (const auto& keyValuePair : frozen)
+    {
+        EXPECT_TRUE(keys.insert(keyValuePair.mKey).second);
+    }
+    EXPECT_EQ(keys.size(), frozen.Size());
+    // One slot per key plus a seed per four keys
+    EXPECT_LT(frozen.ByteSize(), frozen.Size() * (sizeof(uint64_t) * 2 + 2) + 256);
+}
+
+TEST_F(FrozenHashMapFixture, WHEN_built_from_pairs_THEN_duplicates_are_rejected)
+{
+    // The identity std::hash still spreads over the buckets
+    std::vector<std::pair<int, int>> pairs;
+    for (int i = 0; i < 1000; ++i)
+    {
+        pairs.emplace_back(i, -i);
+    }
+    const FrozenHashMap<int, int, std::hash<int>> frozen(pairs.begin(), pairs.end());
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_NE(frozen.Find(i), nullptr);
+        EXPECT_EQ(*frozen.Find(i), -i);
+    }
+    EXPECT_EQ(frozen.Find(1000), nullptr);
+
+    pairs.emplace_back(500, 0);
+    EXPECT_THROW((FrozenHashMap<int, int>(pairs.begin(), pairs.end())), std::invalid_argument);
+
+    const FrozenHashMap<int, int> empty;
+    EXPECT_TRUE(empty.Empty());
+    EXPECT_EQ(empty.Find(0), nullptr);
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST_F(FrozenHashMapFixture, WHEN_saved_and_loaded_THEN_the_mapped_file_answers_lookups)
+{
+    std::vector<std::pair<uint32_t, double>> pairs;
+    for (uint32_t i = 0; i < 5000; ++i)
+    {
+        pairs.emplace_back(i * 7919, i / 2.0);
+    }
+    {
+        const FrozenHashMap<uint32_t, double> frozen(pairs.begin(), pairs.end());
+        frozen.Save(mPath);
+        EXPECT_EQ(std::filesystem::file_size(mPath), frozen.ByteSize());
+    }
+
+    auto loaded = FrozenHashMap<uint32_t, double>::Load(mPath);
+    const auto moved = std::move(loaded);
+    EXPECT_TRUE(loaded.Empty());
+    ASSERT_EQ(moved.Size(), pairs.size());
+    for (const auto& [key, value] : pairs)
+    {
+        ASSERT_NE(moved.Find(key), nullptr);
+        EXPECT_EQ(*moved.Find(key), value);
+    }
+    EXPECT_EQ(moved.Find(1), nullptr);
+
+    EXPECT_THROW((FrozenHashMap<uint64_t, double>::Load(mPath)), std::runtime_error);
+    EXPECT_THROW((FrozenHashMap<uint32_t, double>::Load(mPath + ".missing")), std::runtime_error);
+    {
+        std::ofstream file(mPath);
+        file << std::string(4096, 'x');
+    }
+    EXPECT_THROW((FrozenHashMap<uint32_t, double>::Load(mPath)), std::runtime_error);
+}
+
+}  // namespace Moon::Test
@@ -1,17 +1,25 @@
 #include <CommonTestLib/dummy.hpp>
 #include <CommonTestLib/dummyTracker.hpp>
 #include <AllocatorLib/debugAllocator.hpp>
+#include <CollisionHandlerLib/openAddressingCollisionHandler.hpp>
 #include <MapLib/hashMap.hpp>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 namespace Moon::Test
 {
 using Dummy = Moon::Common::Test::Dummy;
 
 class MapFixture : public ::testing::Test
 {
+   protected:
     void SetUp() override
     {
         ::testing::GTEST_FLAG(throw_on_failure) = true;
@@ -35,6 +43,42 @@ class MapFixture : public ::testing::Test
     DummyTracker* dummyTracker;
 };
 
+// Every key hashes to the same value, so all keys share one probe sequence
+struct ConstantHasher
+{
+    size_t operator()(const int) const
+    {
+        return 42;
+    }
+};
+
+template <typename Data, typename DataHasher>
+using RobinHoodCollisionHandler =
+    OpenAddressingCollisionHandler<Data, DataHasher, HeapAllocator<Data>, RobinHoodProbing>;
+
+template <typename Data, typename DataHasher>
+using PrimeSizedCollisionHandler = OpenAddressingCollisionHandler<Data, DataHasher, HeapAllocator<Data>,
+                                                                  LinearProbing, PrimeSizing>;
+
+template <typename Data, typename DataHasher>
+using IncrementalRehashCollisionHandler =
+    OpenAddressingCollisionHandler<Data, DataHasher, HeapAllocator<Data>, LinearProbing,
+                                   PowerOfTwoSizing, IncrementalRehash<2>>;
+
+// Hashes std::string, std::string_view and string literals alike
+struct TransparentStringHasher
+{
+    using is_transparent = void;
+
+    size_t operator()(const std::string_view key) const
+    {
+        ++callCount;
+        return std::hash<std::string_view>()(key);
+    }
+
+    static inline size_t callCount = 0;
+};
+
 TEST_F(MapFixture, WHEN_map_is_created_THEN_no_elements_are_constructed)
 {
     EXPECT_CALL(*dummyTracker, DefaultConstructor()).Times(0);
@@ -44,4 +88,302 @@ TEST_F(MapFixture, WHEN_map_is_created_THEN_no_elements_are_constructed)
     
     HashMap<int, Dummy> map;
 }
+
+TEST_F(MapFixture, WHEN_keys_are_inserted_THEN_they_are_found)
+{
+    HashMap<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+    {
+        map.Insert(i, i * 10);
+    }
+
+    EXPECT_EQ(map.Size(), 1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto it = map.Find(i);
+        ASSERT_NE(it, map.End());
+        EXPECT_EQ(it->mKey, i);
+        EXPECT_EQ(it->mValue, i * 10);
+    }
+    EXPECT_EQ(map.Find(1000), map.End());
+    EXPECT_EQ(map.Find(-1), map.End());
+}
+
+TEST_F(MapFixture, WHEN_existing_key_is_inserted_THEN_value_is_overwritten)
+{
+    HashMap<std::string, int> map;
+    map.Insert("moon", 1);
+    map.Insert("moon", 2);
+
+    EXPECT_EQ(map.Size(), 1);
+    EXPECT_EQ(map.Find("moon")->mValue, 2);
+}
+
+TEST_F(MapFixture, WHEN_keys_are_deleted_THEN_only_they_disappear)
+{
+    HashMap<int, int> map;
+    for (int i = 0; i < 500; ++i)
+    {
+        map.Insert(i, i);
+    }
+    for (int i = 0; i < 500; i += 2)
+    {
+        EXPECT_TRUE(map.Delete(i));
+    }
+    EXPECT_FALSE(map.Delete(0));
+
+    EXPECT_EQ(map.Size(), 250);
+    for (int i = 0; i < 500; ++i)
+    {
+        EXPECT_EQ(map.Contains(i), i % 2 == 1);
+    }
+}
+
+TEST_F(MapFixture, WHEN_all_keys_collide_THEN_map_still_resolves_them)
+{
+    HashMap<int, int, ConstantHasher> map;
+    for (int i = 0; i < 100; ++i)
+    {
+        map.Insert(i, -i);
+    }
+    for (int i = 0; i < 100; i += 3)
+    {
+        map.Delete(i);
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        auto it = map.Find(i);
+        if (i % 3 == 0)
+        {
+            EXPECT_EQ(it, map.End());
+        }
+        else
+        {
+            ASSERT_NE(it, map.End());
+            EXPECT_EQ(it->mValue, -i);
+        }
+    }
+}
+
+TEST_F(MapFixture, WHEN_keys_are_inserted_and_deleted_repeatedly_THEN_tombstones_are_reclaimed)
+{
+    HashMap<int, int> map;
+    for (int round = 0; round < 100; ++round)
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            map.Insert(round * 50 + i, i);
+        }
+        for (int i = 0; i < 50; ++i)
+        {
+            map.Delete(round * 50 + i);
+        }
+    }
+    EXPECT_TRUE(map.Empty());
+    map.Insert(7, 7);
+    EXPECT_EQ(map.Find(7)->mValue, 7);
+}
+
+TEST_F(MapFixture, WHEN_subscript_is_used_THEN_missing_values_are_default_constructed)
+{
+    HashMap<std::string, int> map;
+    map["a"] += 5;
+    map["a"] += 5;
+    map["b"];
+
+    EXPECT_EQ(map.Size(), 2);
+    EXPECT_EQ(map["a"], 10);
+    EXPECT_EQ(map["b"], 0);
+}
+
+TEST_F(MapFixture, WHEN_map_is_iterated_THEN_every_element_is_visited_once)
+{
+    HashMap<int, int> map;
+    std::set<int> expected;
+    for (int i = 0; i < 300; i += 3)
+    {
+        map.Insert(i, i);
+        expected.insert(i);
+    }
+
+    std::set<int> visited;
+    for (const auto& keyValuePair : map)
+    {
+        EXPECT_TRUE(visited.insert(keyValuePair.mKey).second);
+    }
+    EXPECT_EQ(visited, expected);
+
+    HashMap<int, int> empty;
+    EXPECT_EQ(empty.Begin(), empty.End());
+}
+
+TEST_F(MapFixture, WHEN_map_is_copied_or_moved_THEN_contents_follow)
+{
+    HashMap<int, std::string> map;
+    for (int i = 0; i < 100; ++i)
+    {
+        map.Insert(i, std::to_string(i));
+    }
+
+    HashMap<int, std::string> copy(map);
+    map.Insert(0, "changed");
+    EXPECT_EQ(copy.Find(0)->mValue, "0");
+    EXPECT_EQ(copy.Size(), 100);
+
+    HashMap<int, std::string> moved(std::move(copy));
+    EXPECT_EQ(moved.Find(99)->mValue, "99");
+
+    copy = moved;
+    EXPECT_EQ(copy.Size(), 100);
+}
+
+TEST_F(MapFixture, WHEN_map_is_destroyed_or_cleared_THEN_every_value_is_destroyed)
+{
+    using ::testing::AnyNumber;
+    EXPECT_CALL(*dummyTracker, ArgConstructor()).Times(100);
+    EXPECT_CALL(*dummyTracker, CopyConstructor()).Times(AnyNumber());
+    EXPECT_CALL(*dummyTracker, MoveConstructor()).Times(AnyNumber());
+    EXPECT_CALL(*dummyTracker, Destructor()).Times(AnyNumber());
+    {
+        HashMap<int, Dummy> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.Insert(i, Dummy(i));
+        }
+        map.Clear();
+        EXPECT_TRUE(map.Empty());
+        EXPECT_EQ(map.Find(1), map.End());
+    }
+    BlockExpectations();
+}
+
+template <typename Map>
+void ExpectRandomOperationsAgreeWithStdUnorderedMap()
+{
+    Map map;
+    std::unordered_map<uint64_t, uint64_t> reference;
+    uint64_t state = 12345;
+    for (int i = 0; i < 20000; ++i)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        const uint64_t key = (state >> 33) % 2000;
+        if (state & 1)
+        {
+            map.Insert(key, state);
+            reference[key] = state;
+        }
+        else
+        {
+            EXPECT_EQ(map.Delete(key), reference.erase(key) == 1);
+        }
+    }
+
+    EXPECT_EQ(map.Size(), reference.size());
+    for (const auto& [key, value] : reference)
+    {
+        auto it = map.Find(key);
+        ASSERT_NE(it, map.End());
+        EXPECT_EQ(it->mValue, value);
+    }
+}
+
+TEST_F(MapFixture, WHEN_compared_with_std_unordered_map_THEN_random_operations_agree)
+{
+    ExpectRandomOperationsAgreeWithStdUnorderedMap<HashMap<uint64_t, uint64_t>>();
+}
+
+TEST_F(MapFixture, WHEN_open_addressing_is_used_THEN_random_operations_agree_with_std_unordered_map)
+{
+    ExpectRandomOperationsAgreeWithStdUnorderedMap<
+        HashMap<uint64_t, uint64_t, std::hash<uint64_t>, OpenAddressingCollisionHandler>>();
+}
+
+TEST_F(MapFixture, WHEN_robin_hood_probing_is_used_THEN_random_operations_agree_with_std_unordered_map)
+{
+    ExpectRandomOperationsAgreeWithStdUnorderedMap<
+        HashMap<uint64_t, uint64_t, std::hash<uint64_t>, RobinHoodCollisionHandler>>();
+}
+
+TEST_F(MapFixture, WHEN_prime_sizing_is_used_THEN_random_operations_agree_with_std_unordered_map)
+{
+    ExpectRandomOperationsAgreeWithStdUnorderedMap<
+        HashMap<uint64_t, uint64_t, std::hash<uint64_t>, PrimeSizedCollisionHandler>>();
+}
+
+TEST_F(MapFixture, WHEN_rehashing_incrementally_THEN_random_operations_agree_with_std_unordered_map)
+{
+    ExpectRandomOperationsAgreeWithStdUnorderedMap<
+        HashMap<uint64_t, uint64_t, std::hash<uint64_t>, IncrementalRehashCollisionHandler>>();
+}
+
+TEST_F(MapFixture, WHEN_hasher_is_transparent_THEN_string_views_are_looked_up_directly)
+{
+    HashMap<std::string, int, TransparentStringHasher> map;
+    map.Insert("moon", 1);
+    map.Insert("sun", 2);
+
+    const std::string_view moon = "moon";
+    EXPECT_EQ(map.Find(moon)->mValue, 1);
+    EXPECT_TRUE(map.Contains(std::string_view("sun")));
+    EXPECT_FALSE(map.Contains(std::string_view("star")));
+    EXPECT_EQ(map.HashOf(moon), map.HashOf(std::string("moon")));
+
+    EXPECT_TRUE(map.Delete(moon));
+    EXPECT_FALSE(map.Contains(moon));
+    EXPECT_EQ(map.Size(), 1);
+}
+
+TEST_F(MapFixture, WHEN_hash_is_precomputed_THEN_maps_reuse_it_without_rehashing)
+{
+    HashMap<std::string, int, TransparentStringHasher> first(64);
+    HashMap<std::string, int, TransparentStringHasher> second(64);
+
+    TransparentStringHasher::callCount = 0;
+    const std::string key = "shared";
+    const size_t hash = first.HashOf(key);
+    first.InsertWithHash(key, 1, hash);
+    second.InsertWithHash(key, 2, hash);
+    EXPECT_EQ(first.FindWithHash(key, hash)->mValue, 1);
+    EXPECT_EQ(second.FindWithHash(std::string_view(key), hash)->mValue, 2);
+    EXPECT_TRUE(second.DeleteWithHash(key, hash));
+    EXPECT_EQ(TransparentStringHasher::callCount, 1);
+
+    EXPECT_EQ(first.Find(key)->mValue, 1);
+    EXPECT_EQ(second.Find(key), second.End());
+}
+TEST_F(MapFixture, WHEN_keys_are_inserted_and_found_in_batches_THEN_results_match_single_calls)
+{
+    HashMap<int, int> map;
+    std::vector<int> keys;
+    std::vector<int> values;
+    for (int i = 0; i < 1000; ++i)
+    {
+        keys.push_back(i * 3);
+        values.push_back(i);
+    }
+    // Grows the table in the middle of a batch
+    map.InsertBatch(keys.data(), values.data(), keys.size());
+    EXPECT_EQ(map.Size(), 1000);
+
+    std::vector<int> lookups;
+    for (int i = 0; i < 3003; ++i)
+    {
+        lookups.push_back(i);
+    }
+    std::vector<HashMap<int, int>::IteratorType> results(lookups.size());
+    map.FindBatch(lookups.data(), lookups.size(), results.data());
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+        EXPECT_EQ(results[i], map.Find(lookups[i]));
+        if (lookups[i] % 3 == 0 && lookups[i] < 3000)
+        {
+            EXPECT_EQ(results[i]->mValue, lookups[i] / 3);
+        }
+    }
+
+    HashMap<int, int> empty;
+    empty.FindBatch(lookups.data(), 5, results.data());
+    EXPECT_EQ(results[4], empty.End());
+}
 }  // namespace Moon::Test
@@ -0,0 +1,218 @@
+#include <MapLib/lruCache.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Moon::Test
+{
+
+class LruCacheFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+
+    static constexpr int THREAD_COUNT = 8;
+};
+
+// Counts the allocations of the containers that use it, so a test sees what
+// copying a value costs without replacing the global operator new
+size_t allocationCount = 0;
+
+template <typename T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(const size_t count)
+    {
+        ++allocationCount;
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, const size_t count) noexcept
+    {
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const CountingAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+using CountedString = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+TEST_F(LruCacheFixture, WHEN_shard_is_full_THEN_least_recently_used_entry_is_evicted)
+{
+    std::vector<std::pair<int, std::string>> evicted;
+    LruCache<int, std::string> cache(3, 1, [&evicted](const int key, const std::string& value) {
+        evicted.emplace_back(key, value);
+    });
+    cache.Insert(1, "one", 1);
+    cache.Insert(2, "two", 1);
+    cache.Insert(3, "three", 1);
+
+    // 1 becomes the most recent, 2 the least
+    std::string value;
+    EXPECT_TRUE(cache.Find(1, value));
+    EXPECT_EQ(value, "one");
+    EXPECT_TRUE(cache.Contains(2));
+    cache.Insert(4, "four", 1);
+
+    EXPECT_EQ(evicted, (std::vector<std::pair<int, std::string>>{{2, "two"}}));
+    EXPECT_FALSE(cache.Find(2, value));
+    EXPECT_EQ(cache.Size(), 3);
+
+    // Replacing 3 makes it the most recent, 1 goes next
+    cache.Insert(3, "THREE", 1);
+    cache.Insert(5, "five", 1);
+    EXPECT_EQ(evicted.back(), std::make_pair(1, std::string("one")));
+    EXPECT_TRUE(cache.Find(3, value));
+    EXPECT_EQ(value, "THREE");
+}
+
+TEST_F(LruCacheFixture, WHEN_entries_have_byte_sizes_THEN_capacity_counts_bytes)
+{
+    std::vector<int> evicted;
+    LruCache<int, int> cache(100, 1, [&evicted](const int key, int) { evicted.push_back(key); });
+    EXPECT_EQ(cache.GetByteCapacity(), 100);
+
+    EXPECT_FALSE(cache.Insert(0, 0, 101));
+    EXPECT_TRUE(cache.Insert(1, 1, 40));
+    EXPECT_TRUE(cache.Insert(2, 2, 40));
+    EXPECT_EQ(cache.GetBytes(), 80);
+
+    // Growing 2 pushes out 1 even though 2 was inserted last
+    EXPECT_TRUE(cache.Insert(2, 2, 70));
+    EXPECT_EQ(evicted, std::vector<int>{1});
+    EXPECT_EQ(cache.GetBytes(), 70);
+
+    // One entry of the whole capacity evicts everything else
+    EXPECT_TRUE(cache.Insert(3, 3, 100));
+    EXPECT_EQ(evicted, (std::vector<int>{1, 2}));
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_EQ(cache.GetBytes(), 100);
+}
+
+TEST_F(LruCacheFixture, WHEN_entries_are_deleted_or_cleared_THEN_no_eviction_is_reported)
+{
+    int evictions = 0;
+    LruCache<uint64_t, uint64_t> cache(16 * LruCache<uint64_t, uint64_t>::DEFAULT_ENTRY_BYTES, 1,
+                                       [&evictions](uint64_t, uint64_t) { ++evictions; });
+    for (uint64_t key = 0; key < 16; ++key)
+    {
+        cache.Insert(key, key);
+    }
+    EXPECT_TRUE(cache.Delete(3));
+    EXPECT_FALSE(cache.Delete(3));
+    EXPECT_EQ(cache.Size(), 15);
+
+    // The freed node takes the next key without evicting
+    cache.Insert(100, 100);
+    EXPECT_EQ(evictions, 0);
+    cache.Insert(101, 101);
+    EXPECT_EQ(evictions, 1);
+    EXPECT_FALSE(cache.Contains(0));
+
+    cache.Clear();
+    EXPECT_EQ(evictions, 1);
+    EXPECT_EQ(cache.Size(), 0);
+    EXPECT_EQ(cache.GetBytes(), 0);
+    uint64_t value = 0;
+    EXPECT_FALSE(cache.Find(100, value));
+}
+
+TEST_F(LruCacheFixture, WHEN_hit_is_read_through_a_function_THEN_value_is_not_copied)
+{
+    LruCache<int, CountedString> cache(1024, 1);
+    const CountedString longValue(100, 'x');
+    cache.Insert(1, longValue, 1);
+    cache.Insert(2, longValue + "y", 1);
+
+    size_t length = 0;
+    const size_t before = allocationCount;
+    EXPECT_TRUE(cache.Find(1, [&length](const CountedString& value) { length = value.size(); }));
+    EXPECT_TRUE(cache.Find(2, [&length](const CountedString& value) { length += value.size(); }));
+    EXPECT_FALSE(cache.Find(3, [&length](const CountedString&) { length = 0; }));
+    const size_t allocations = allocationCount - before;
+
+    EXPECT_EQ(allocations, 0);
+    EXPECT_EQ(length, 201);
+
+    // The copying Find allocates as often as copying the value does
+    CountedString copy;
+    const size_t beforeCopy = allocationCount;
+    EXPECT_TRUE(cache.Find(1, copy));
+    EXPECT_EQ(allocationCount - beforeCopy, 1);
+    EXPECT_EQ(copy, longValue);
+}
+
+TEST_F(LruCacheFixture, WHEN_byte_capacity_leaves_a_shard_nothing_THEN_constructor_throws)
+{
+    EXPECT_THROW((LruCache<int, int>(15, 16)), std::invalid_argument);
+}
+
+TEST_F(LruCacheFixture, WHEN_threads_share_the_cache_THEN_every_hit_returns_its_value)
+{
+    constexpr uint64_t KEY_COUNT = 4096;
+    LruCache<uint64_t, uint64_t> cache(1024 * LruCache<uint64_t, uint64_t>::DEFAULT_ENTRY_BYTES);
+
+    std::vector<std::thread> threads;
+    std::vector<int> wrongValues(THREAD_COUNT, 0);
+    for (int thread = 0; thread < THREAD_COUNT; ++thread)
+    {
+        threads.emplace_back([&cache, &wrongValues, thread]() {
+            uint64_t state = thread + 1;
+            for (int i = 0; i < 20000; ++i)
+            {
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+                const uint64_t key = (state >> 33) % KEY_COUNT;
+                uint64_t value = 0;
+                if (cache.Find(key, value))
+                {
+                    wrongValues[thread] += value != key * 2;
+                }
+                else
+                {
+                    cache.Insert(key, key * 2);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    constexpr size_t ENTRY_BYTES = LruCache<uint64_t, uint64_t>::DEFAULT_ENTRY_BYTES;
+    EXPECT_EQ(wrongValues, std::vector<int>(THREAD_COUNT, 0));
+    EXPECT_LE(cache.GetBytes(), cache.GetByteCapacity());
+    EXPECT_EQ(cache.GetBytes(), cache.Size() * ENTRY_BYTES);
+}
+
+}  // namespace Moon::Test
@@ -0,0 +1,167 @@
+#include <MapLib/smallHashMap.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace Moon::Test
+{
+
+class SmallHashMapFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+};
+
+TEST_F(SmallHashMapFixture, WHEN_up_to_N_keys_are_inserted_THEN_map_stays_inline)
+{
+    SmallHashMap<uint32_t, int, 4> map;
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Find(1), nullptr);
+
+    for (uint32_t key = 1; key <= 4; ++key)
+    {
+        map.Insert(key, static_cast<int>(key) * 10);
+    }
+    map.Insert(3, 33);
+
+    EXPECT_TRUE(map.IsInline());
+    EXPECT_EQ(map.Size(), 4);
+    EXPECT_EQ(*map.Find(1), 10);
+    EXPECT_EQ(*map.Find(3), 33);
+    EXPECT_FALSE(map.Contains(5));
+    EXPECT_FALSE(map.Contains(0));
+}
+
+TEST_F(SmallHashMapFixture, WHEN_N_plus_one_keys_are_inserted_THEN_all_entries_move_to_the_table)
+{
+    SmallHashMap<uint64_t, std::string, 4> map;
+    for (uint64_t key = 0; key < 5; ++key)
+    {
+        map[key] = std::to_string(key);
+    }
+
+    EXPECT_FALSE(map.IsInline());
+    EXPECT_EQ(map.Size(), 5);
+    for (uint64_t key = 0; key < 5; ++key)
+    {
+        EXPECT_EQ(*map.Find(key), std::to_string(key));
+    }
+
+    // Shrinking keeps the table, Clear goes back inline
+    EXPECT_TRUE(map.Delete(4));
+    EXPECT_TRUE(map.Delete(3));
+    EXPECT_FALSE(map.IsInline());
+    EXPECT_EQ(map.Size(), 3);
+    map.Clear();
+    EXPECT_TRUE(map.IsInline());
+    EXPECT_TRUE(map.Empty());
+}
+
+TEST_F(SmallHashMapFixture, WHEN_inline_key_is_deleted_THEN_stale_slot_is_not_found)
+{
+    SmallHashMap<int32_t, int, 8> map;
+    for (int32_t key = 0; key < 6; ++key)
+    {
+        map.Insert(key, key);
+    }
+
+    EXPECT_TRUE(map.Delete(2));
+    EXPECT_TRUE(map.Delete(5));
+    EXPECT_FALSE(map.Delete(5));
+
+    // The last key filled the hole of 2, its old slot still holds its bytes
+    EXPECT_EQ(map.Size(), 4);
+    EXPECT_FALSE(map.Contains(2));
+    EXPECT_FALSE(map.Contains(5));
+    for (const int32_t key : {0, 1, 3, 4})
+    {
+        EXPECT_EQ(*map.Find(key), key);
+    }
+}
+
+TEST_F(SmallHashMapFixture, WHEN_inline_keys_span_several_scan_masks_THEN_each_is_found)
+{
+    SmallHashMap<uint64_t, size_t, 40> map;
+    for (size_t i = 0; i < 40; ++i)
+    {
+        map.Insert(i * 0x100000001, i);
+        ASSERT_TRUE(map.IsInline());
+        for (size_t j = 0; j <= i; ++j)
+        {
+            ASSERT_EQ(*map.Find(j * 0x100000001), j);
+        }
+        // Matches one half of a key but not the other
+        ASSERT_FALSE(map.Contains(i + 1));
+    }
+}
+
+TEST_F(SmallHashMapFixture, WHEN_keys_are_inserted_and_deleted_at_random_THEN_map_matches_std_map)
+{
+    SmallHashMap<std::string, int, 8> map;
+    std::map<std::string, int> expected;
+    uint32_t state = 1;
+    for (int i = 0; i < 2000; ++i)
+    {
+        state = state * 1664525 + 1013904223;
+        const std::string key = std::to_string((state >> 16) % 12);
+        if ((state >> 8) % 3 == 0)
+        {
+            EXPECT_EQ(map.Delete(key), expected.erase(key) == 1);
+        }
+        else
+        {
+            map.Insert(key, i);
+            expected[key] = i;
+        }
+        if (i % 500 == 0)
+        {
+            map.Clear();
+            expected.clear();
+        }
+        ASSERT_EQ(map.Size(), expected.size());
+    }
+
+    std::map<std::string, int> visited;
+    map.ForEach([&visited](const std::string& key, const int value) { visited[key] = value; });
+    EXPECT_EQ(visited, expected);
+}
+
+TEST_F(SmallHashMapFixture, WHEN_map_is_copied_or_moved_THEN_entries_follow)
+{
+    SmallHashMap<int, std::string, 2> inlineMap;
+    inlineMap.Insert(1, "one");
+    SmallHashMap<int, std::string, 2> tableMap;
+    for (int key = 0; key < 3; ++key)
+    {
+        tableMap.Insert(key, std::to_string(key));
+    }
+
+    SmallHashMap<int, std::string, 2> inlineCopy(inlineMap);
+    SmallHashMap<int, std::string, 2> tableCopy;
+    tableCopy = tableMap;
+    inlineCopy.Insert(2, "two");
+    tableCopy.Delete(0);
+    EXPECT_EQ(inlineMap.Size(), 1);
+    EXPECT_EQ(tableMap.Size(), 3);
+
+    SmallHashMap<int, std::string, 2> inlineMoved(std::move(inlineMap));
+    SmallHashMap<int, std::string, 2> tableMoved;
+    tableMoved = std::move(tableMap);
+    EXPECT_EQ(*inlineMoved.Find(1), "one");
+    EXPECT_TRUE(inlineMoved.IsInline());
+    EXPECT_EQ(*tableMoved.Find(2), "2");
+    EXPECT_FALSE(tableMoved.IsInline());
+    EXPECT_TRUE(inlineMap.Empty());
+    EXPECT_TRUE(tableMap.Empty());
+}
+
+}  // namespace Moon::Test
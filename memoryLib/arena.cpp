@@ -2,30 +2,89 @@
 #include <MemoryLib/arenaChunkHeader.hpp>
 #include <CommonLib/math.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <new>
 
 namespace Moon
 {
 
-ArenaChunk* Arena::RequestChunk(const size_t size)
+ArenaChunk* Arena::RequestChunk(const size_t size, const size_t alignment)
 {
     assert(size > 0);
+    assert((alignment & (alignment - 1)) == 0);
 
-    for (auto& memBlock : mMemoryBlocks)
+    // Worst case padding needed in front of an over-aligned chunk
+    const size_t maxPadding = alignment > ArenaMemoryBlock::SIZE_ALIGNMENT
+                                  ? alignment - ArenaMemoryBlock::SIZE_ALIGNMENT
+                                  : 0;
+
+    auto blockIndex = mBlockIndex.FindFirstAtLeast(size + maxPadding);
+    while (blockIndex != ArenaBlockIndex::NPOS)
     {
-        auto chunk = memBlock.RequestEmptyChunk(size);
+        auto& memBlock = mMemoryBlocks[blockIndex];
+        // Skip the free list scan when no free chunk is big enough
+        auto chunk = memBlock.GetLargestFreeChunkSize() >= size
+                         ? memBlock.RequestEmptyChunk(size, alignment)
+                         : nullptr;
         if (chunk)
+        {
+            RecordScopeReuse(blockIndex, chunk);
+            if constexpr (ARENA_STATS_ENABLED)
+            {
+                ++mCounters.mRequestHits;
+            }
+        }
+        else if (memBlock.CanFit(size, alignment))
+        {
+            chunk = memBlock.CreateNewChunk(size, true, alignment);
+            if constexpr (ARENA_STATS_ENABLED)
+            {
+                ++mCounters.mRequestMisses;
+            }
+        }
+        mBlockIndex.Update(blockIndex, memBlock.GetMaxRequestableSize());
+        if (chunk)
+        {
             return chunk;
-
-        if (memBlock.CanFit(size))
+        }
+        // An over-aligned request can fail on a block whose free chunks are
+        // large enough but misaligned, searching again would find it again
+        if (maxPadding > 0)
         {
-            return memBlock.CreateNewChunk(size, true);
+            break;
         }
+        // The largest free chunk was overestimated after a scope was closed,
+        // the failed scan above has corrected it
+        blockIndex = mBlockIndex.FindFirstAtLeast(size);
     }
 
-    const auto newMemoryBlockSize = std::max(mDefaultAllocationSize, ArenaMemoryBlock::CalcTotalAllocationSize(size));
-    mMemoryBlocks.emplace_back(newMemoryBlockSize);
-    return mMemoryBlocks.back().CreateNewChunk(size, true);
+    const auto newMemoryBlockSize = std::max(
+        mNextBlockSize, ArenaMemoryBlock::CalcTotalAllocationSize(size) + maxPadding);
+    const bool useHugePages =
+        mConfig.mHugePageThreshold != 0 && newMemoryBlockSize >= mConfig.mHugePageThreshold;
+    mMemoryBlocks.emplace_back(newMemoryBlockSize, static_cast<uint32_t>(mMemoryBlocks.size()), useHugePages);
+    // The pages are not touched yet, so mapping before charging costs no memory
+    if (mConfig.mBudget && !mConfig.mBudget->TryCharge(mMemoryBlocks.back().GetCapacity()))
+    {
+        mMemoryBlocks.back().Release();
+        mMemoryBlocks.pop_back();
+        throw std::bad_alloc();
+    }
+    mNextBlockSize = std::max(
+        mDefaultAllocationSize,
+        std::min(mNextBlockSize * mConfig.mBlockGrowthFactor, mConfig.mMaxBlockSize));
+
+    if constexpr (ARENA_STATS_ENABLED)
+    {
+        ++mCounters.mRequestMisses;
+        ++mCounters.mNewBlocks;
+    }
+
+    auto& memBlock = mMemoryBlocks.back();
+    auto chunk = memBlock.CreateNewChunk(size, true, alignment);
+    mBlockIndex.PushBack(memBlock.GetMaxRequestableSize());
+    return chunk;
 }
 
 void Arena::ReleaseChunk(ArenaChunk* arenaChunk)
@@ -39,9 +98,137 @@ void Arena::ReleaseChunk(ArenaChunk* arenaChunk)
 
     if (chunkHeader->mIsUsed)
     {
-        chunkHeader->mIsUsed = false;
+        auto& memBlock = mMemoryBlocks[chunkHeader->mBlockIndex];
+        memBlock.ReleaseChunk(chunkHeader);
+        // Rewinding would invalidate the block states saved by open scopes
+        if (!memBlock.HasUsedChunks() && mScopeStarts.empty())
+        {
+            memBlock.Reset(mConfig.mReleaseFreeBlocks);
+        }
+        mBlockIndex.Update(chunkHeader->mBlockIndex, memBlock.GetMaxRequestableSize());
     }
 }
 
-}  // namespace Moon
+ArenaChunk* Arena::TryExtendChunk(ArenaChunk* arenaChunk, const size_t newSize)
+{
+    auto* chunkHeader = static_cast<ArenaChunkHeader*>(arenaChunk);
+    assert(chunkHeader->mIsUsed && "TryExtendChunk(): chunk is not in use");
+
+    const auto blockIndex = chunkHeader->mBlockIndex;
+    auto& memBlock = mMemoryBlocks[blockIndex];
+
+    // Moving the header of a chunk that predates the innermost scope would
+    // invalidate the chunk list tail saved by that scope
+    if (!mScopeStarts.empty())
+    {
+        const auto scopeStart = mScopeStarts.back();
+        const auto savedBlockCount = mScopeStates.size() - scopeStart;
+        if (blockIndex < savedBlockCount &&
+            !memBlock.IsChunkNewerThan(chunkHeader, mScopeStates[scopeStart + blockIndex]))
+        {
+            return nullptr;
+        }
+    }
+
+    auto* extendedChunk = memBlock.TryExtendChunk(chunkHeader, newSize);
+    if (extendedChunk && extendedChunk != arenaChunk)
+    {
+        mBlockIndex.Update(blockIndex, memBlock.GetMaxRequestableSize());
+    }
+    return extendedChunk;
+}
+
+ArenaStats Arena::GetStats() const
+{
+    ArenaStats stats;
+    stats.mBlocks.reserve(mMemoryBlocks.size());
+    for (const auto& memBlock : mMemoryBlocks)
+    {
+        memBlock.CollectStats(stats);
+    }
+    stats.mCounters = mCounters;
+    return stats;
+}
 
+void Arena::Reset()
+{
+    assert(mScopeStarts.empty() && "Reset(): called inside an ArenaScope");
+
+    for (size_t i = 0; i < mMemoryBlocks.size(); ++i)
+    {
+        mMemoryBlocks[i].Reset(mConfig.mReleaseFreeBlocks);
+        mBlockIndex.Update(i, mMemoryBlocks[i].GetMaxRequestableSize());
+    }
+}
+
+size_t Arena::OpenScope()
+{
+    const auto scopeStart = mScopeStates.size();
+    for (const auto& memBlock : mMemoryBlocks)
+    {
+        mScopeStates.push_back(memBlock.GetState());
+    }
+    mScopeStarts.push_back(scopeStart);
+    mScopeReuseStarts.push_back(mScopeReusedChunks.size());
+    return scopeStart;
+}
+
+void Arena::CloseScope(const size_t scopeStart)
+{
+    assert(!mScopeStarts.empty() && mScopeStarts.back() == scopeStart &&
+           "CloseScope(): scopes must be closed in reverse order");
+
+    // Inner scopes are closed first, so everything after scopeStart is ours
+    const auto savedBlockCount = mScopeStates.size() - scopeStart;
+    for (size_t i = 0; i < mMemoryBlocks.size(); ++i)
+    {
+        auto& memBlock = mMemoryBlocks[i];
+        if (i < savedBlockCount)
+        {
+            if (!memBlock.RestoreState(mScopeStates[scopeStart + i]))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            memBlock.Reset();
+        }
+        mBlockIndex.Update(i, memBlock.GetMaxRequestableSize());
+    }
+
+    mScopeStates.resize(scopeStart);
+    mScopeStarts.pop_back();
+
+    // Free chunks that predate the scope but were handed out inside it. A
+    // chunk released and handed out again is listed twice.
+    const auto reuseStart = mScopeReuseStarts.back();
+    mScopeReuseStarts.pop_back();
+    std::sort(mScopeReusedChunks.begin() + reuseStart, mScopeReusedChunks.end());
+    const auto reuseEnd =
+        std::unique(mScopeReusedChunks.begin() + reuseStart, mScopeReusedChunks.end());
+    for (auto it = mScopeReusedChunks.begin() + reuseStart; it != reuseEnd; ++it)
+    {
+        ReleaseChunk(static_cast<ArenaChunk*>(*it));
+    }
+    mScopeReusedChunks.resize(reuseStart);
+}
+
+void Arena::RecordScopeReuse(const size_t blockIndex, ArenaChunk* chunk)
+{
+    if (mScopeStarts.empty())
+    {
+        return;
+    }
+    // Blocks created inside the innermost scope are reset when it closes, and
+    // chunks newer than its saved state are dropped by RestoreState
+    const auto scopeStart = mScopeStarts.back();
+    const auto savedBlockCount = mScopeStates.size() - scopeStart;
+    if (blockIndex < savedBlockCount &&
+        !mMemoryBlocks[blockIndex].IsChunkNewerThan(chunk, mScopeStates[scopeStart + blockIndex]))
+    {
+        mScopeReusedChunks.push_back(static_cast<ArenaChunkHeader*>(chunk));
+    }
+}
+
+}  // namespace Moon
@@ -0,0 +1,78 @@
+#include <MemoryLib/arenaBlockIndex.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace Moon
+{
+
+void ArenaBlockIndex::PushBack(const size_t value)
+{
+    if (mSize == mLeafCount)
+    {
+        Grow();
+    }
+    Update(mSize++, value);
+}
+
+void ArenaBlockIndex::Update(const size_t index, const size_t value)
+{
+    assert(index < mLeafCount);
+
+    size_t node = mLeafCount + index;
+    mTree[node] = value;
+    for (node >>= 1; node > 0; node >>= 1)
+    {
+        mTree[node] = std::max(mTree[2 * node], mTree[2 * node + 1]);
+    }
+}
+
+void ArenaBlockIndex::Clear()
+{
+    mTree.clear();
+    mLeafCount = 0;
+    mSize = 0;
+}
+
+size_t ArenaBlockIndex::FindFirstAtLeast(const size_t minValue) const
+{
+    if (mSize == 0 || mTree[1] < minValue)
+    {
+        return NPOS;
+    }
+
+    size_t node = 1;
+    while (node < mLeafCount)
+    {
+        node = mTree[2 * node] >= minValue ? 2 * node : 2 * node + 1;
+    }
+    return node - mLeafCount;
+}
+
+size_t ArenaBlockIndex::Get(const size_t index) const
+{
+    assert(index < mSize);
+    return mTree[mLeafCount + index];
+}
+
+size_t ArenaBlockIndex::Size() const
+{
+    return mSize;
+}
+
+void ArenaBlockIndex::Grow()
+{
+    const size_t newLeafCount = mLeafCount == 0 ? 1 : mLeafCount * 2;
+    std::vector<size_t> newTree(2 * newLeafCount, 0);
+
+    std::copy(mTree.begin() + mLeafCount, mTree.begin() + mLeafCount + mSize,
+              newTree.begin() + newLeafCount);
+    for (size_t node = newLeafCount - 1; node > 0; --node)
+    {
+        newTree[node] = std::max(newTree[2 * node], newTree[2 * node + 1]);
+    }
+
+    mTree = std::move(newTree);
+    mLeafCount = newLeafCount;
+}
+}  // namespace Moon
@@ -0,0 +1,190 @@
+#include <CommonLib/math.hpp>
+#include <MemoryLib/arenaImage.hpp>
+#include <MemoryLib/pageAllocator.hpp>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+
+namespace Moon
+{
+
+static_assert(sizeof(ArenaImageHeader) <= ArenaImage::HEADER_SIZE);
+
+ArenaImage::ArenaImage(const std::string& path, const size_t capacity)
+    : mFd(-1), mMapping(nullptr), mMappingSize(0), mMemoryBlock(nullptr, 0)
+{
+    mFd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (mFd < 0)
+    {
+        throw std::runtime_error("ArenaImage(): cannot create " + path);
+    }
+
+    const auto mappingSize =
+        Util::Math::AlignSize(HEADER_SIZE + capacity, PageAllocator::GetPageSize());
+    if (ftruncate(mFd, static_cast<off_t>(mappingSize)) != 0)
+    {
+        close(mFd);
+        throw std::runtime_error("ArenaImage(): cannot resize " + path);
+    }
+    Map(mappingSize);
+    mMemoryBlock = ArenaMemoryBlock(mMapping + HEADER_SIZE, mappingSize - HEADER_SIZE);
+
+    auto* header = GetHeader();
+    header->mMagic = ArenaImageHeader::MAGIC;
+    header->mVersion = ArenaImageHeader::VERSION;
+    header->mChunkHeaderSize = sizeof(ArenaChunkHeader);
+    header->mCapacity = mMemoryBlock.GetCapacity();
+    header->mRootOffset = ArenaImageHeader::NO_OFFSET;
+    SaveHeader();
+}
+
+ArenaImage::ArenaImage(const std::string& path)
+    : mFd(-1), mMapping(nullptr), mMappingSize(0), mMemoryBlock(nullptr, 0)
+{
+    mFd = open(path.c_str(), O_RDWR);
+    if (mFd < 0)
+    {
+        throw std::runtime_error("ArenaImage(): cannot open " + path);
+    }
+
+    struct stat fileStat;
+    if (fstat(mFd, &fileStat) != 0 || static_cast<size_t>(fileStat.st_size) < HEADER_SIZE)
+    {
+        close(mFd);
+        throw std::runtime_error("ArenaImage(): " + path + " is not an arena image");
+    }
+    Map(static_cast<size_t>(fileStat.st_size));
+
+    const auto* header = GetHeader();
+    if (header->mMagic != ArenaImageHeader::MAGIC ||
+        header->mVersion != ArenaImageHeader::VERSION ||
+        header->mChunkHeaderSize != sizeof(ArenaChunkHeader) ||
+        header->mCapacity + HEADER_SIZE > mMappingSize)
+    {
+        PageAllocator::Unmap(mMapping, mMappingSize);
+        close(mFd);
+        throw std::runtime_error("ArenaImage(): " + path + " is not an arena image");
+    }
+    mMemoryBlock = ArenaMemoryBlock(mMapping + HEADER_SIZE, header->mCapacity);
+    LoadHeader();
+}
+
+ArenaImage::~ArenaImage()
+{
+    Flush();
+    PageAllocator::Unmap(mMapping, mMappingSize);
+    close(mFd);
+}
+
+ArenaChunk* ArenaImage::RequestChunk(const size_t size, const size_t alignment)
+{
+    if (mMemoryBlock.GetLargestFreeChunkSize() >= size)
+    {
+        if (auto* chunk = mMemoryBlock.RequestEmptyChunk(size, alignment))
+        {
+            return chunk;
+        }
+    }
+    if (!mMemoryBlock.CanFit(size, alignment))
+    {
+        return nullptr;
+    }
+    return mMemoryBlock.CreateNewChunk(size, true, alignment);
+}
+
+void ArenaImage::ReleaseChunk(ArenaChunk* arenaChunk)
+{
+    if (arenaChunk == nullptr)
+    {
+        return;
+    }
+
+    auto* chunkHeader = static_cast<ArenaChunkHeader*>(arenaChunk);
+    mMemoryBlock.ReleaseChunk(chunkHeader);
+    if (!mMemoryBlock.HasUsedChunks())
+    {
+        mMemoryBlock.Reset();
+    }
+}
+
+void ArenaImage::SetRoot(const void* root)
+{
+    GetHeader()->mRootOffset =
+        root ? static_cast<uint64_t>(static_cast<const std::byte*>(root) - mMemoryBlock.mStart)
+             : ArenaImageHeader::NO_OFFSET;
+}
+
+void* ArenaImage::GetRoot() const
+{
+    const auto rootOffset = GetHeader()->mRootOffset;
+    if (rootOffset == ArenaImageHeader::NO_OFFSET)
+    {
+        return nullptr;
+    }
+    return mMemoryBlock.mStart + rootOffset;
+}
+
+void ArenaImage::Flush()
+{
+    SaveHeader();
+    PageAllocator::Sync(mMapping, mMappingSize);
+}
+
+size_t ArenaImage::GetCapacity() const
+{
+    return mMemoryBlock.GetCapacity();
+}
+
+size_t ArenaImage::GetRemainingSize()
+{
+    return mMemoryBlock.GetRemainingSize();
+}
+
+void ArenaImage::Map(const size_t mappingSize)
+{
+    try
+    {
+        mMapping = PageAllocator::MapFile(mFd, mappingSize);
+    }
+    catch (const std::bad_alloc&)
+    {
+        close(mFd);
+        throw std::runtime_error("ArenaImage(): cannot map image");
+    }
+    mMappingSize = mappingSize;
+}
+
+// The block itself keeps raw pointers, only their offsets go into the image
+void ArenaImage::SaveHeader()
+{
+    auto* header = GetHeader();
+    header->mOffset = mMemoryBlock.mOffset;
+    header->mChunkHeadersOffset =
+        mMemoryBlock.mChunkHeaders
+            ? static_cast<uint64_t>(reinterpret_cast<std::byte*>(mMemoryBlock.mChunkHeaders) -
+                                    mMemoryBlock.mStart)
+            : ArenaImageHeader::NO_OFFSET;
+    header->mLargestFreeChunkSize = mMemoryBlock.mLargestFreeChunkSize;
+    header->mUsedChunkCount = mMemoryBlock.mUsedChunkCount;
+}
+
+void ArenaImage::LoadHeader()
+{
+    const auto* header = GetHeader();
+    mMemoryBlock.mOffset = header->mOffset;
+    mMemoryBlock.mChunkHeaders =
+        header->mChunkHeadersOffset != ArenaImageHeader::NO_OFFSET
+            ? reinterpret_cast<ArenaChunkHeader*>(mMemoryBlock.mStart + header->mChunkHeadersOffset)
+            : nullptr;
+    mMemoryBlock.mLargestFreeChunkSize = header->mLargestFreeChunkSize;
+    mMemoryBlock.mUsedChunkCount = static_cast<uint32_t>(header->mUsedChunkCount);
+}
+
+ArenaImageHeader* ArenaImage::GetHeader() const
+{
+    return reinterpret_cast<ArenaImageHeader*>(mMapping);
+}
+}  // namespace Moon
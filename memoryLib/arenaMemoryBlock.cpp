@@ -2,10 +2,10 @@
 #include <MemoryLib/arenaChunk.hpp>
 #include <MemoryLib/arenaChunkHeader.hpp>
 #include <MemoryLib/arenaMemoryBlock.hpp>
+#include <algorithm>
 #include <climits>
 #include <new>
 
-#define PAGE_SIZE 1024  // TODO: Change this according to system
 //
 // header will always be aligned - let allocation size = 2^n. header size
 // alignment = 2m (even) since llocation size > header_size, header_start = 2^n
@@ -18,7 +18,7 @@
 namespace Moon
 {
 
-ArenaChunk* ArenaMemoryBlock::RequestEmptyChunk(const size_t size)
+ArenaChunk* ArenaMemoryBlock::RequestEmptyChunk(const size_t size, const size_t alignment)
 {
     if (mChunkHeaders == nullptr)
     {
@@ -28,16 +28,32 @@ ArenaChunk* ArenaMemoryBlock::RequestEmptyChunk(const size_t size)
     auto cur = mChunkHeaders;
     size_t bestSize = INT_MAX;
     ArenaChunkHeader* bestChunkHeader = nullptr;
+    // Two largest free capacities, so the largest free chunk is still known
+    // after the best fit is taken
+    size_t largestFree = 0;
+    size_t secondLargestFree = 0;
 
     while (true)
     {
-        if (!cur->mIsUsed && cur->GetCapacity() >= size)
+        if (!cur->mIsUsed)
         {
-            if (cur->GetCapacity() < bestSize)
+            const size_t capacity = cur->GetCapacity();
+            if (capacity >= size && capacity < bestSize &&
+                (alignment <= SIZE_ALIGNMENT ||
+                 reinterpret_cast<uintptr_t>(cur->GetData()) % alignment == 0))
             {
-                bestSize = cur->GetCapacity();
+                bestSize = capacity;
                 bestChunkHeader = cur;
             }
+            if (capacity > largestFree)
+            {
+                secondLargestFree = largestFree;
+                largestFree = capacity;
+            }
+            else if (capacity > secondLargestFree)
+            {
+                secondLargestFree = capacity;
+            }
         }
         if (cur->mNext == mChunkHeaders)
         {
@@ -49,22 +65,44 @@ ArenaChunk* ArenaMemoryBlock::RequestEmptyChunk(const size_t size)
     if (bestChunkHeader)
     {
         bestChunkHeader->mIsUsed = true;
+        ++mUsedChunkCount;
+        mLargestFreeChunkSize = bestSize == largestFree ? secondLargestFree : largestFree;
         return static_cast<ArenaChunk*>(bestChunkHeader);
     }
+    mLargestFreeChunkSize = largestFree;
     return nullptr;
 }
 
-ArenaChunk* ArenaMemoryBlock::CreateNewChunk(const size_t requestedSize, const bool setIsUsed)
+ArenaChunk* ArenaMemoryBlock::CreateNewChunk(const size_t requestedSize, const bool setIsUsed,
+                                             const size_t alignment)
 {
+    if (alignment > SIZE_ALIGNMENT)
+    {
+        // The padding is at least SIZE_ALIGNMENT, enough room for a header
+        const auto padding = CalcAlignmentPadding(alignment);
+        if (padding > 0)
+        {
+            CreateNewChunk(padding - sizeof(ArenaChunkHeader));
+        }
+    }
+
     const auto totalSize = CalcTotalAllocationSize(requestedSize);
     const size_t chunkSizeAndPadding = totalSize - sizeof(ArenaChunkHeader);
 
     const auto chunkPtr = mStart + mOffset;
     const auto headerPtr =
         reinterpret_cast<ArenaChunkHeader*>(chunkPtr + chunkSizeAndPadding);
-    new (headerPtr) ArenaChunkHeader(chunkPtr, chunkSizeAndPadding);
+    new (headerPtr) ArenaChunkHeader(chunkPtr, chunkSizeAndPadding, mIndex);
 
     headerPtr->mIsUsed = setIsUsed;
+    if (setIsUsed)
+    {
+        ++mUsedChunkCount;
+    }
+    else if (chunkSizeAndPadding > mLargestFreeChunkSize)
+    {
+        mLargestFreeChunkSize = chunkSizeAndPadding;
+    }
 
     mOffset += totalSize;
 
@@ -85,6 +123,88 @@ ArenaChunk* ArenaMemoryBlock::CreateNewChunk(const size_t requestedSize, const b
     return static_cast<ArenaChunk*>(headerPtr);
 }
 
+void ArenaMemoryBlock::ReleaseChunk(ArenaChunkHeader* chunkHeader)
+{
+    if (!chunkHeader->mIsUsed)
+    {
+        return;
+    }
+
+    chunkHeader->mIsUsed = false;
+    --mUsedChunkCount;
+    if (chunkHeader->GetCapacity() > mLargestFreeChunkSize)
+    {
+        mLargestFreeChunkSize = chunkHeader->GetCapacity();
+    }
+}
+
+ArenaChunk* ArenaMemoryBlock::TryExtendChunk(ArenaChunkHeader* chunkHeader, const size_t newSize)
+{
+    if (newSize <= chunkHeader->GetCapacity())
+    {
+        return chunkHeader;
+    }
+
+    const auto headerEnd = reinterpret_cast<std::byte*>(chunkHeader) + sizeof(ArenaChunkHeader);
+    if (headerEnd != mStart + mOffset)
+    {
+        return nullptr;
+    }
+
+    const auto chunkPtr = static_cast<std::byte*>(chunkHeader->GetData());
+    const auto newTotalSize = CalcTotalAllocationSize(newSize);
+    const auto chunkOffset = static_cast<uint64_t>(chunkPtr - mStart);
+    if (chunkOffset + newTotalSize > mCapacity)
+    {
+        return nullptr;
+    }
+
+    // The chunk grows by at least SIZE_ALIGNMENT > sizeof(ArenaChunkHeader),
+    // so the old and new headers never overlap
+    const size_t newChunkSizeAndPadding = newTotalSize - sizeof(ArenaChunkHeader);
+    const auto newHeaderPtr =
+        reinterpret_cast<ArenaChunkHeader*>(chunkPtr + newChunkSizeAndPadding);
+    new (newHeaderPtr) ArenaChunkHeader(chunkPtr, newChunkSizeAndPadding, mIndex);
+    newHeaderPtr->mIsUsed = chunkHeader->mIsUsed;
+    newHeaderPtr->mOwnerId = chunkHeader->mOwnerId;
+
+    if (chunkHeader->mNext == chunkHeader)
+    {
+        newHeaderPtr->mNext = newHeaderPtr;
+        newHeaderPtr->mPrev = newHeaderPtr;
+    }
+    else
+    {
+        newHeaderPtr->mNext = chunkHeader->mNext;
+        newHeaderPtr->mPrev = chunkHeader->mPrev;
+        chunkHeader->mPrev->mNext = newHeaderPtr;
+        chunkHeader->mNext->mPrev = newHeaderPtr;
+    }
+    if (mChunkHeaders == chunkHeader)
+    {
+        mChunkHeaders = newHeaderPtr;
+    }
+
+    mOffset = chunkOffset + newTotalSize;
+    return static_cast<ArenaChunk*>(newHeaderPtr);
+}
+
+size_t ArenaMemoryBlock::GetLargestFreeChunkSize() const
+{
+    return mLargestFreeChunkSize;
+}
+
+size_t ArenaMemoryBlock::GetMaxRequestableSize() const
+{
+    // CalcTotalAllocationSize(size) <= remaining iff size + header fits in the
+    // remaining space rounded down to SIZE_ALIGNMENT
+    const size_t alignedRemaining = (mCapacity - mOffset) / SIZE_ALIGNMENT * SIZE_ALIGNMENT;
+    const size_t maxNewChunkSize = alignedRemaining > sizeof(ArenaChunkHeader)
+                                       ? alignedRemaining - sizeof(ArenaChunkHeader)
+                                       : 0;
+    return std::max<size_t>(maxNewChunkSize, mLargestFreeChunkSize);
+}
+
 size_t ArenaMemoryBlock::GetRemainingSize()
 {
     return mCapacity - mOffset;
@@ -95,9 +215,21 @@ size_t ArenaMemoryBlock::GetCapacity() const
     return mCapacity;
 }
 
-bool ArenaMemoryBlock::CanFit(const size_t requestedSize)
+bool ArenaMemoryBlock::CanFit(const size_t requestedSize, const size_t alignment)
 {
-    return GetRemainingSize() >= CalcTotalAllocationSize(requestedSize);
+    const size_t padding = alignment > SIZE_ALIGNMENT ? CalcAlignmentPadding(alignment) : 0;
+    return GetRemainingSize() >= padding + CalcTotalAllocationSize(requestedSize);
+}
+
+size_t ArenaMemoryBlock::CalcAlignmentPadding(const size_t alignment) const
+{
+    const auto address = reinterpret_cast<uintptr_t>(mStart + mOffset);
+    return Util::Math::AlignSize(address, alignment) - address;
+}
+
+bool ArenaMemoryBlock::HasUsedChunks() const
+{
+    return mUsedChunkCount > 0;
 }
 
 size_t ArenaMemoryBlock::CalcTotalAllocationSize(const size_t requestedSize)
@@ -111,11 +243,115 @@ void ArenaMemoryBlock::Release()
 {
     if (mStart)
     {
-        free(mStart);
+        PageAllocator::Unmap(mStart, mCapacity);
         mStart = nullptr;
         mCapacity = 0;
         mOffset = 0;
         mChunkHeaders = nullptr;
+        mLargestFreeChunkSize = 0;
+        mUsedChunkCount = 0;
+    }
+}
+
+void ArenaMemoryBlock::Reset(const bool discardPages)
+{
+    if (discardPages && mOffset > 0)
+    {
+        PageAllocator::Discard(
+            mStart, Util::Math::AlignSize(mOffset, PageAllocator::GetPageSize()));
+    }
+    mOffset = 0;
+    mChunkHeaders = nullptr;
+    mLargestFreeChunkSize = 0;
+    mUsedChunkCount = 0;
+}
+
+void ArenaMemoryBlock::CollectStats(ArenaStats& stats) const
+{
+    ArenaBlockStats blockStats;
+    blockStats.mCapacity = mCapacity;
+    blockStats.mOffset = mOffset;
+
+    if (mChunkHeaders)
+    {
+        auto cur = mChunkHeaders;
+        do
+        {
+            const auto capacity = cur->GetCapacity();
+            ++blockStats.mChunkCount;
+            if (cur->mIsUsed)
+            {
+                ++blockStats.mUsedChunkCount;
+                blockStats.mUsedChunkBytes += capacity;
+            }
+            else
+            {
+                blockStats.mFreeChunkBytes += capacity;
+                blockStats.mLargestFreeChunk = std::max(blockStats.mLargestFreeChunk, capacity);
+            }
+            ++stats.mChunkSizeHistogram[ArenaStats::GetHistogramBucket(capacity)];
+            cur = cur->mNext;
+        } while (cur != mChunkHeaders);
+    }
+
+    stats.mTotalCapacity += mCapacity;
+    stats.mUsedChunkBytes += blockStats.mUsedChunkBytes;
+    stats.mFreeChunkBytes += blockStats.mFreeChunkBytes;
+    stats.mBumpBytes += mCapacity - mOffset;
+    stats.mHeaderOverheadBytes += blockStats.mChunkCount * sizeof(ArenaChunkHeader);
+    stats.mLargestFreeChunk = std::max(stats.mLargestFreeChunk, blockStats.mLargestFreeChunk);
+    stats.mBlocks.push_back(blockStats);
+}
+
+ArenaMemoryBlockState ArenaMemoryBlock::GetState() const
+{
+    return ArenaMemoryBlockState{mOffset, mChunkHeaders ? mChunkHeaders->mPrev.Get() : nullptr,
+                                 mLargestFreeChunkSize};
+}
+
+bool ArenaMemoryBlock::IsChunkNewerThan(ArenaChunk* chunk, const ArenaMemoryBlockState& state) const
+{
+    return static_cast<std::byte*>(chunk->GetData()) >= mStart + state.mOffset;
+}
+
+bool ArenaMemoryBlock::RestoreState(const ArenaMemoryBlockState& state)
+{
+    // Blocks are never rewound while a state is held, so an unchanged offset
+    // means no chunk was created since
+    if (mOffset == state.mOffset)
+    {
+        return false;
+    }
+
+    // Chunks are appended at the tail of the list, so everything after the
+    // saved tail was created later
+    auto* dropped = state.mLastChunkHeader ? state.mLastChunkHeader->mNext : mChunkHeaders;
+    while (true)
+    {
+        if (dropped->mIsUsed)
+        {
+            --mUsedChunkCount;
+        }
+        if (dropped->mNext == mChunkHeaders)
+        {
+            break;
+        }
+        dropped = dropped->mNext;
+    }
+
+    if (state.mLastChunkHeader)
+    {
+        state.mLastChunkHeader->mNext = mChunkHeaders;
+        mChunkHeaders->mPrev = state.mLastChunkHeader;
+    }
+    else
+    {
+        mChunkHeaders = nullptr;
     }
+    mOffset = state.mOffset;
+    // May overestimate if the largest free chunk was dropped, RequestEmptyChunk
+    // recomputes it on the next scan
+    mLargestFreeChunkSize = std::max(mLargestFreeChunkSize, state.mLargestFreeChunkSize);
+    return true;
 }
 }  // namespace Moon
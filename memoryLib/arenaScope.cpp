@@ -0,0 +1 @@
+#include <MemoryLib/arenaScope.hpp>
@@ -0,0 +1,87 @@
+#include <MemoryLib/arenaStats.hpp>
+
+#include <sstream>
+
+namespace Moon
+{
+
+double ArenaStats::GetUtilisation() const
+{
+    if (mTotalCapacity == 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(mUsedChunkBytes) / mTotalCapacity;
+}
+
+double ArenaStats::GetFragmentation() const
+{
+    if (mFreeChunkBytes == 0)
+    {
+        return 0.0;
+    }
+    return 1.0 - static_cast<double>(mLargestFreeChunk) / mFreeChunkBytes;
+}
+
+std::string ArenaStats::ToJson() const
+{
+    std::ostringstream out;
+    out << "{";
+    out << "\"totalCapacity\":" << mTotalCapacity;
+    out << ",\"usedChunkBytes\":" << mUsedChunkBytes;
+    out << ",\"freeChunkBytes\":" << mFreeChunkBytes;
+    out << ",\"bumpBytes\":" << mBumpBytes;
+    out << ",\"headerOverheadBytes\":" << mHeaderOverheadBytes;
+    out << ",\"largestFreeChunk\":" << mLargestFreeChunk;
+    out << ",\"utilisation\":" << GetUtilisation();
+    out << ",\"fragmentation\":" << GetFragmentation();
+
+    out << ",\"counters\":{";
+    out << "\"enabled\":" << (ARENA_STATS_ENABLED ? "true" : "false");
+    out << ",\"requestHits\":" << mCounters.mRequestHits;
+    out << ",\"requestMisses\":" << mCounters.mRequestMisses;
+    out << ",\"newBlocks\":" << mCounters.mNewBlocks;
+    out << "}";
+
+    out << ",\"chunkSizeHistogram\":[";
+    bool first = true;
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i)
+    {
+        if (mChunkSizeHistogram[i] == 0)
+        {
+            continue;
+        }
+        out << (first ? "" : ",") << "{\"minSize\":" << (uint64_t{1} << i)
+            << ",\"count\":" << mChunkSizeHistogram[i] << "}";
+        first = false;
+    }
+    out << "]";
+
+    out << ",\"blocks\":[";
+    for (size_t i = 0; i < mBlocks.size(); ++i)
+    {
+        const auto& block = mBlocks[i];
+        out << (i == 0 ? "" : ",") << "{";
+        out << "\"capacity\":" << block.mCapacity;
+        out << ",\"offset\":" << block.mOffset;
+        out << ",\"chunkCount\":" << block.mChunkCount;
+        out << ",\"usedChunkCount\":" << block.mUsedChunkCount;
+        out << ",\"usedChunkBytes\":" << block.mUsedChunkBytes;
+        out << ",\"freeChunkBytes\":" << block.mFreeChunkBytes;
+        out << ",\"largestFreeChunk\":" << block.mLargestFreeChunk;
+        out << "}";
+    }
+    out << "]}";
+    return out.str();
+}
+
+size_t ArenaStats::GetHistogramBucket(const uint64_t chunkSize)
+{
+    size_t bucket = 0;
+    for (uint64_t size = chunkSize; size > 1; size >>= 1)
+    {
+        ++bucket;
+    }
+    return bucket;
+}
+}  // namespace Moon
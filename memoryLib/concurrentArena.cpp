@@ -0,0 +1,227 @@
+#include <MemoryLib/concurrentArena.hpp>
+#include <MemoryLib/pageAllocator.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace Moon
+{
+
+namespace
+{
+std::atomic<uint64_t> nextArenaId{1};
+
+// Arenas that are still alive, so that an exiting thread only hands its
+// caches back to those
+struct LiveArenas
+{
+    std::mutex mMutex;
+    std::unordered_map<uint64_t, ConcurrentArena*> mArenas;
+};
+
+LiveArenas& GetLiveArenas()
+{
+    static LiveArenas liveArenas;
+    return liveArenas;
+}
+}  // namespace
+
+// The caches of one thread keyed by arena id. Ids are never reused, so the
+// entry of a destroyed arena can never match again.
+struct ConcurrentArenaThreadCaches
+{
+    struct Entry
+    {
+        uint64_t mArenaId;
+        ConcurrentArena::ThreadCache* mCache;
+    };
+
+    ConcurrentArenaThreadCaches() = default;
+    ConcurrentArenaThreadCaches(const ConcurrentArenaThreadCaches&) = delete;
+    ConcurrentArenaThreadCaches& operator=(const ConcurrentArenaThreadCaches&) = delete;
+
+    ~ConcurrentArenaThreadCaches()
+    {
+        auto& liveArenas = GetLiveArenas();
+        std::lock_guard<std::mutex> lock(liveArenas.mMutex);
+        for (const auto& entry : mEntries)
+        {
+            const auto it = liveArenas.mArenas.find(entry.mArenaId);
+            if (it != liveArenas.mArenas.end())
+            {
+                it->second->OrphanThreadCache(*entry.mCache);
+            }
+        }
+    }
+
+    ConcurrentArena::ThreadCache* Find(const uint64_t arenaId) const
+    {
+        for (const auto& entry : mEntries)
+        {
+            if (entry.mArenaId == arenaId)
+            {
+                return entry.mCache;
+            }
+        }
+        return nullptr;
+    }
+
+    // Also drops the entries of destroyed arenas, so the map only grows with
+    // the number of live arenas
+    void Add(const uint64_t arenaId, ConcurrentArena::ThreadCache* cache)
+    {
+        {
+            auto& liveArenas = GetLiveArenas();
+            std::lock_guard<std::mutex> lock(liveArenas.mMutex);
+            mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(),
+                                          [&liveArenas](const Entry& entry) {
+                                              return liveArenas.mArenas.count(entry.mArenaId) == 0;
+                                          }),
+                           mEntries.end());
+        }
+        mEntries.push_back(Entry{arenaId, cache});
+    }
+
+    std::vector<Entry> mEntries;
+};
+
+namespace
+{
+thread_local ConcurrentArenaThreadCaches threadCaches;
+}  // namespace
+
+ConcurrentArena::ConcurrentArena(const size_t minAllocationSize, const ArenaConfig& config)
+    : mId(nextArenaId.fetch_add(1, std::memory_order_relaxed)),
+      mDefaultAllocationSize(
+          Util::Math::AlignSize(minAllocationSize, PageAllocator::GetPageSize())),
+      mConfig(config)
+{
+    auto& liveArenas = GetLiveArenas();
+    std::lock_guard<std::mutex> lock(liveArenas.mMutex);
+    liveArenas.mArenas.emplace(mId, this);
+}
+
+ConcurrentArena::~ConcurrentArena()
+{
+    auto& liveArenas = GetLiveArenas();
+    std::lock_guard<std::mutex> lock(liveArenas.mMutex);
+    liveArenas.mArenas.erase(mId);
+}
+
+ArenaChunk* ConcurrentArena::RequestChunk(const size_t size, const size_t alignment)
+{
+    auto& cache = GetThreadCache();
+    if (cache.mRemoteFrees.load(std::memory_order_relaxed) != nullptr)
+    {
+        DrainRemoteFrees(cache);
+    }
+
+    auto* chunk = cache.mArena.RequestChunk(size, alignment);
+    static_cast<ArenaChunkHeader*>(chunk)->mOwnerId = cache.mId;
+    return chunk;
+}
+
+void ConcurrentArena::ReleaseChunk(ArenaChunk* arenaChunk)
+{
+    if (arenaChunk == nullptr)
+    {
+        return;
+    }
+
+    // A thread that only releases takes no cache, it would use up a slot and
+    // could throw from a destructor
+    auto* chunkHeader = static_cast<ArenaChunkHeader*>(arenaChunk);
+    auto* cache = threadCaches.Find(mId);
+    if (cache != nullptr && chunkHeader->mOwnerId == cache->mId)
+    {
+        cache->mArena.ReleaseChunk(arenaChunk);
+        return;
+    }
+
+    auto* owner = mCaches[chunkHeader->mOwnerId].load(std::memory_order_acquire);
+    assert(owner != nullptr);
+    auto* head = owner->mRemoteFrees.load(std::memory_order_relaxed);
+    do
+    {
+        NextRemoteFree(chunkHeader) = head;
+    } while (!owner->mRemoteFrees.compare_exchange_weak(head, chunkHeader));
+
+    // Either the exiting owner drains after this push, or this sees the
+    // orphaned flag it set before draining, both are sequentially consistent
+    if (owner->mOrphaned.load())
+    {
+        std::lock_guard<std::mutex> lock(mRegistryMutex);
+        if (owner->mOrphaned.load(std::memory_order_relaxed))
+        {
+            DrainRemoteFrees(*owner);
+        }
+    }
+}
+
+ConcurrentArena::ThreadCache& ConcurrentArena::GetThreadCache()
+{
+    if (auto* cache = threadCaches.Find(mId))
+    {
+        return *cache;
+    }
+
+    auto& cache = RegisterThreadCache();
+    threadCaches.Add(mId, &cache);
+    return cache;
+}
+
+ConcurrentArena::ThreadCache& ConcurrentArena::RegisterThreadCache()
+{
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+
+    // Remote frees left in an adopted cache are drained on its next request
+    if (!mOrphanedCaches.empty())
+    {
+        auto& cache = *mCacheStorage[mOrphanedCaches.back()];
+        mOrphanedCaches.pop_back();
+        cache.mOrphaned.store(false);
+        return cache;
+    }
+
+    const auto id = mCacheStorage.size();
+    if (id >= MAX_THREAD_CACHES)
+    {
+        throw std::runtime_error("ConcurrentArena(): too many threads");
+    }
+
+    mCacheStorage.push_back(std::make_unique<ThreadCache>(static_cast<uint16_t>(id),
+                                                          mDefaultAllocationSize, mConfig));
+    mCaches[id].store(mCacheStorage.back().get(), std::memory_order_release);
+    return *mCacheStorage.back();
+}
+
+void ConcurrentArena::OrphanThreadCache(ThreadCache& cache)
+{
+    cache.mOrphaned.store(true);
+    std::lock_guard<std::mutex> lock(mRegistryMutex);
+    DrainRemoteFrees(cache);
+    mOrphanedCaches.push_back(cache.mId);
+}
+
+void ConcurrentArena::DrainRemoteFrees(ThreadCache& cache)
+{
+    // Sequentially consistent, pairs with the push and flag check of ReleaseChunk
+    auto* chunkHeader = cache.mRemoteFrees.exchange(nullptr);
+    while (chunkHeader)
+    {
+        auto* next = NextRemoteFree(chunkHeader);
+        cache.mArena.ReleaseChunk(chunkHeader);
+        chunkHeader = next;
+    }
+}
+
+ArenaChunkHeader*& ConcurrentArena::NextRemoteFree(ArenaChunkHeader* chunkHeader)
+{
+    // Every chunk has room for at least one pointer, see CalcTotalAllocationSize
+    return *static_cast<ArenaChunkHeader**>(chunkHeader->GetData());
+}
+}  // namespace Moon
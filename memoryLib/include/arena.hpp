@@ -1,16 +1,18 @@
 #pragma once
 
 #include <CommonLib/math.hpp>
+#include <MemoryLib/arenaBlockIndex.hpp>
 #include <MemoryLib/arenaChunk.hpp>
 #include <MemoryLib/arenaChunkHeader.hpp>
+#include <MemoryLib/arenaConfig.hpp>
 #include <MemoryLib/arenaMemoryBlock.hpp>
+#include <MemoryLib/arenaStats.hpp>
+#include <MemoryLib/pageAllocator.hpp>
 
 #include <cstddef>
 #include <cstdlib>
 #include <vector>
 
-#define PAGE_SIZE 1024  // TODO: Change this according to system
-
 namespace Moon::Test
 {
 class ArenaFixture;
@@ -19,12 +21,16 @@ class ArenaFixture;
 namespace Moon
 {
 
+class ArenaScope;
+
 class Arena
 {
    public:
-    Arena(const size_t minAllocationSize)
+    Arena(const size_t minAllocationSize, const ArenaConfig& config = ArenaConfig())
         : mDefaultAllocationSize(
-              Util::Math::AlignSize(minAllocationSize, PAGE_SIZE))
+              Util::Math::AlignSize(minAllocationSize, PageAllocator::GetPageSize())),
+          mNextBlockSize(mDefaultAllocationSize),
+          mConfig(config)
     {
     }
     Arena(const Arena&) = delete;
@@ -35,26 +41,64 @@ class Arena
     {
         for (auto& block : mMemoryBlocks)
         {
+            if (mConfig.mBudget)
+            {
+                mConfig.mBudget->Release(block.GetCapacity());
+            }
             block.Release();
         }
     }
 
-    ArenaChunk* RequestChunk(const size_t size);
+    // alignment must be a power of two, chunks are SIZE_ALIGNMENT aligned at no extra cost
+    ArenaChunk* RequestChunk(const size_t size,
+                             const size_t alignment = ArenaMemoryBlock::SIZE_ALIGNMENT);
     void ReleaseChunk(ArenaChunk* arenaChunk);
+
+    // Grows a used chunk in place when it is the last chunk carved from its
+    // block. Returns the chunk to use from now on, or nullptr if it could not
+    // grow, in which case the old chunk is untouched.
+    ArenaChunk* TryExtendChunk(ArenaChunk* arenaChunk, const size_t newSize);
     ArenaMemoryBlock ConstructMemoryBlock(const size_t size);
 
+    // Drops every chunk but keeps the blocks mapped, so a warm arena can be
+    // refilled without going back to the OS. Must not be called inside an ArenaScope.
+    void Reset();
+
     size_t GetDefaultAllocationSize() const
     {
         return mDefaultAllocationSize;
     }
 
+    // Walks every block and chunk, meant for diagnostics rather than the hot path
+    ArenaStats GetStats() const;
+
    private:
     size_t AlignSize(const size_t size, const size_t alignment);
+    size_t OpenScope();
+    void CloseScope(const size_t scopeStart);
+    // Remembers a free chunk from before the innermost scope that the scope
+    // reused, CloseScope releases it again
+    void RecordScopeReuse(const size_t blockIndex, ArenaChunk* chunk);
 
    private:
     size_t mDefaultAllocationSize;
+    size_t mNextBlockSize;
+    ArenaConfig mConfig;
     std::vector<ArenaMemoryBlock> mMemoryBlocks;
+    // mBlockIndex[i] == mMemoryBlocks[i].GetMaxRequestableSize()
+    ArenaBlockIndex mBlockIndex;
+    // Block states saved by every open scope, innermost scope last
+    std::vector<ArenaMemoryBlockState> mScopeStates;
+    // Start of each open scope within mScopeStates
+    std::vector<size_t> mScopeStarts;
+    // Pre-scope free chunks reused by every open scope, innermost scope last
+    std::vector<ArenaChunkHeader*> mScopeReusedChunks;
+    // Start of each open scope within mScopeReusedChunks
+    std::vector<size_t> mScopeReuseStarts;
+    // Only updated when ARENA_STATS_ENABLED
+    ArenaCounters mCounters;
 
+    friend class ArenaScope;
     friend class Moon::Test::ArenaFixture;
 };
 }  // namespace Moon
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Moon
+{
+
+// Max segment tree over the memory blocks of an arena. Each leaf holds the
+// largest request size its block can still serve, so the first block able to
+// serve a request is found in O(log blocks) instead of scanning every block.
+class ArenaBlockIndex
+{
+   public:
+    static constexpr size_t NPOS = std::numeric_limits<size_t>::max();
+
+    void PushBack(const size_t value);
+    void Update(const size_t index, const size_t value);
+    void Clear();
+
+    // Returns the lowest index whose value is >= minValue, NPOS if none
+    size_t FindFirstAtLeast(const size_t minValue) const;
+    size_t Get(const size_t index) const;
+    size_t Size() const;
+
+   private:
+    void Grow();
+
+   private:
+    // 1-based heap layout, leaves start at mLeafCount
+    std::vector<size_t> mTree;
+    size_t mLeafCount{0};
+    size_t mSize{0};
+};
+}  // namespace Moon
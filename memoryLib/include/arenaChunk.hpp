@@ -1,5 +1,7 @@
 #pragma once
 
+#include <MemoryLib/relativePtr.hpp>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -16,7 +18,8 @@ class ArenaChunk
     size_t GetCapacity();
 
    private:
-    std::byte* mStart;
+    // Relative so the chunk list survives being mapped at another address, see ArenaImage
+    RelativePtr<std::byte> mStart;
     std::uint64_t mCapacity;
 
 };
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <MemoryLib/arenaChunk.hpp>
+#include <MemoryLib/relativePtr.hpp>
+
+#include <cstdint>
 
 namespace Moon
 {
@@ -9,12 +12,22 @@ namespace Moon
 class ArenaChunkHeader : public ArenaChunk
 {
    public:
-    ArenaChunkHeader* mNext;
-    ArenaChunkHeader* mPrev;
+    // Offsets rather than pointers, the list needs no fix-ups when an
+    // ArenaImage is mapped at a different address
+    RelativePtr<ArenaChunkHeader> mNext;
+    RelativePtr<ArenaChunkHeader> mPrev;
     bool mIsUsed;
+    // Both ids fit in the padding after mIsUsed, the header stays 40 bytes
+    uint16_t mOwnerId;  // owning thread cache, only used by ConcurrentArena
+    uint32_t mBlockIndex;  // owning block within its arena
 
-    ArenaChunkHeader(std::byte* chunkPtr, const size_t chunkSize)
-        : ArenaChunk(chunkPtr, chunkSize), mNext(nullptr), mPrev(nullptr), mIsUsed(false)
+    ArenaChunkHeader(std::byte* chunkPtr, const size_t chunkSize, const uint32_t blockIndex = 0)
+        : ArenaChunk(chunkPtr, chunkSize),
+          mNext(),
+          mPrev(),
+          mIsUsed(false),
+          mOwnerId(0),
+          mBlockIndex(blockIndex)
     {
     }
 };
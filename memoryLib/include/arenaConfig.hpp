@@ -0,0 +1,27 @@
+#pragma once
+
+#include <MemoryLib/memoryBudget.hpp>
+
+#include <cstddef>
+
+namespace Moon
+{
+
+struct ArenaConfig
+{
+    // Each new block is this many times bigger than the previous one, until
+    // it reaches mMaxBlockSize. 1 keeps every block at the default size.
+    size_t mBlockGrowthFactor = 2;
+    size_t mMaxBlockSize = 64 * 1024 * 1024;
+
+    // Blocks at least this big are backed by huge pages, 0 disables it
+    size_t mHugePageThreshold = 0;
+
+    // Give the pages of a block back to the OS once all of its chunks are released
+    bool mReleaseFreeBlocks = false;
+
+    // Blocks are charged when they are mapped and released when the arena is
+    // destroyed. RequestChunk throws std::bad_alloc once the hard limit is hit.
+    MemoryBudget* mBudget = nullptr;
+};
+}  // namespace Moon
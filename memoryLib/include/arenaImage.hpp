@@ -0,0 +1,84 @@
+#pragma once
+
+#include <MemoryLib/arenaChunk.hpp>
+#include <MemoryLib/arenaChunkHeader.hpp>
+#include <MemoryLib/arenaMemoryBlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Moon
+{
+
+// Layout of the first bytes of an image file, the chunks follow it
+struct ArenaImageHeader
+{
+    static constexpr uint64_t MAGIC = 0x45474d49414e4f4d;  // "MONAIMGE"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint64_t NO_OFFSET = UINT64_MAX;
+
+    uint64_t mMagic;
+    uint32_t mVersion;
+    // Images are only portable between builds with the same chunk header
+    uint32_t mChunkHeaderSize;
+    uint64_t mCapacity;
+    uint64_t mOffset;
+    uint64_t mChunkHeadersOffset;
+    uint64_t mLargestFreeChunkSize;
+    uint64_t mUsedChunkCount;
+    uint64_t mRootOffset;
+};
+
+// Single block arena living in a shared file mapping. The chunk list only holds
+// relative pointers, so a flushed image can be mapped again by another process
+// at any address and used straight away. Anything stored inside the chunks has
+// to follow the same rule, e.g. link through RelativePtr, and the root object
+// is found again through SetRoot/GetRoot.
+//
+// The capacity is fixed when the image is created, RequestChunk returns
+// nullptr once it is used up.
+class ArenaImage
+{
+   public:
+    static constexpr size_t HEADER_SIZE = ArenaMemoryBlock::SIZE_ALIGNMENT;
+
+    // Creates or truncates the file at path, throws std::runtime_error on failure
+    ArenaImage(const std::string& path, const size_t capacity);
+    // Maps an existing image, throws std::runtime_error if the file is not
+    // an image written by this build
+    explicit ArenaImage(const std::string& path);
+    ArenaImage(const ArenaImage&) = delete;
+    ArenaImage(ArenaImage&&) = delete;
+    ArenaImage& operator=(const ArenaImage&) = delete;
+    ArenaImage& operator=(ArenaImage&&) = delete;
+    // Flushes and unmaps
+    ~ArenaImage();
+
+    ArenaChunk* RequestChunk(const size_t size,
+                             const size_t alignment = ArenaMemoryBlock::SIZE_ALIGNMENT);
+    void ReleaseChunk(ArenaChunk* arenaChunk);
+
+    // Pointer into the image that is handed back by GetRoot after a reopen
+    void SetRoot(const void* root);
+    void* GetRoot() const;
+
+    // Writes the block state into the image header and syncs the mapping
+    void Flush();
+
+    size_t GetCapacity() const;
+    size_t GetRemainingSize();
+
+   private:
+    void Map(const size_t mappingSize);
+    void SaveHeader();
+    void LoadHeader();
+    ArenaImageHeader* GetHeader() const;
+
+   private:
+    int mFd;
+    std::byte* mMapping;
+    size_t mMappingSize;
+    ArenaMemoryBlock mMemoryBlock;
+};
+}  // namespace Moon
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <CommonLib/math.hpp>
 #include <MemoryLib/arenaChunkHeader.hpp>
+#include <MemoryLib/arenaStats.hpp>
+#include <MemoryLib/pageAllocator.hpp>
 #include <cstdlib>
 #include <iostream>
 
@@ -11,40 +14,105 @@ class ArenaFixture;
 namespace Moon
 {
 
+class ArenaImage;
+
+// Everything needed to rewind a block to an earlier point, see ArenaScope
+struct ArenaMemoryBlockState
+{
+    uint64_t mOffset;
+    ArenaChunkHeader* mLastChunkHeader;
+    uint64_t mLargestFreeChunkSize;
+};
+
 struct ArenaMemoryBlock
 {
    public:
-    ArenaMemoryBlock(const size_t capacity)
+    // Capacity is rounded up to the page size (or HUGE_PAGE_SIZE with useHugePages)
+    ArenaMemoryBlock(const size_t capacity, const uint32_t index = 0, const bool useHugePages = false)
         : mStart(nullptr),
+          mCapacity(Util::Math::AlignSize(
+              capacity, useHugePages ? PageAllocator::HUGE_PAGE_SIZE : PageAllocator::GetPageSize())),
+          mOffset(0),
+          mChunkHeaders(nullptr),
+          mLargestFreeChunkSize(0),
+          mUsedChunkCount(0),
+          mIndex(index)
+    {
+        mStart = PageAllocator::Map(mCapacity, useHugePages);
+    }
+
+    // Carves chunks out of memory owned by the caller, Release must not be called
+    ArenaMemoryBlock(std::byte* start, const size_t capacity)
+        : mStart(start),
           mCapacity(capacity),
           mOffset(0),
-          mChunkHeaders(nullptr)
+          mChunkHeaders(nullptr),
+          mLargestFreeChunkSize(0),
+          mUsedChunkCount(0),
+          mIndex(0)
     {
-        mStart = static_cast<std::byte*>(malloc(capacity));
     }
 
-    ArenaChunk* RequestEmptyChunk(const size_t size);
+    // Chunk data is always SIZE_ALIGNMENT aligned, alignment must be a power of two
+    ArenaChunk* RequestEmptyChunk(const size_t size, const size_t alignment = SIZE_ALIGNMENT);
 
-    // Assumes that there is enough space in the memory block for this chunk
-    ArenaChunk* CreateNewChunk(const size_t requestedSize, const bool setIsUsed = false);
+    // Assumes that there is enough space in the memory block for this chunk,
+    // see CanFit. A larger alignment is reached by first carving a free
+    // padding chunk, so the chunk list stays contiguous.
+    ArenaChunk* CreateNewChunk(const size_t requestedSize, const bool setIsUsed = false,
+                               const size_t alignment = SIZE_ALIGNMENT);
+    void ReleaseChunk(ArenaChunkHeader* chunkHeader);
+
+    // Grows the chunk in place if it is the last chunk of the block and the
+    // bump space behind it is large enough. The header moves behind the new
+    // end, so the returned chunk replaces the old one. Returns nullptr on failure.
+    ArenaChunk* TryExtendChunk(ArenaChunkHeader* chunkHeader, const size_t newSize);
     size_t GetCapacity() const;
     size_t GetRemainingSize();
-    bool CanFit(const size_t requestedSize);
+    bool CanFit(const size_t requestedSize, const size_t alignment = SIZE_ALIGNMENT);
+    bool HasUsedChunks() const;
     void Release();
 
+    // Drops every chunk and rewinds the block, keeping the mapping.
+    // With discardPages the physical pages are handed back to the OS.
+    void Reset(const bool discardPages = false);
+
+    ArenaMemoryBlockState GetState() const;
+    // Drops every chunk created after the state was taken, in O(dropped chunks).
+    // The block must not have been Reset in between. Returns false if nothing changed.
+    bool RestoreState(const ArenaMemoryBlockState& state);
+    bool IsChunkNewerThan(ArenaChunk* chunk, const ArenaMemoryBlockState& state) const;
+
+    // Never underestimates as long as chunks are only released through ReleaseChunk
+    size_t GetLargestFreeChunkSize() const;
+
+    // Largest request size that RequestEmptyChunk or CreateNewChunk can serve
+    size_t GetMaxRequestableSize() const;
+
+    // Walks every chunk, appends this block to stats.mBlocks and adds to the totals
+    void CollectStats(ArenaStats& stats) const;
+
     // Total size = requested size + padding (extra size given to chunk) + header size
     static size_t CalcTotalAllocationSize(const size_t requestedSize);
 public:
     static constexpr uint64_t SIZE_ALIGNMENT = 64;
 
+   private:
+    // Bytes to skip before the next chunk so its data is aligned, a multiple of SIZE_ALIGNMENT
+    size_t CalcAlignmentPadding(const size_t alignment) const;
+
    private:
     std::byte* mStart;
     uint64_t mCapacity;
     uint64_t mOffset;
     ArenaChunkHeader* mChunkHeaders;
+    uint64_t mLargestFreeChunkSize;
+    uint32_t mUsedChunkCount;
+    uint32_t mIndex;
 
     friend class Moon::Test::ArenaMemoryBlockFixture;
     friend class Moon::Test::ArenaFixture;
+    friend class ArenaImage;
 };
 
 }  // namespace Moon
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <MemoryLib/arena.hpp>
+
+#include <cstddef>
+
+namespace Moon
+{
+
+// Releases everything requested from the arena during its lifetime, e.g. all
+// allocations of one request. Blocks stay mapped, so reusing a warm arena
+// causes no mmap/munmap traffic. Scopes nest and must be destroyed in reverse
+// order of construction. Chunks that predate the scope may still be released
+// inside it, and free chunks that predate it are released again if the scope
+// reused them.
+class ArenaScope
+{
+   public:
+    explicit ArenaScope(Arena& arena) : mArena(arena), mScopeStart(arena.OpenScope()) {}
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+    ~ArenaScope()
+    {
+        mArena.CloseScope(mScopeStart);
+    }
+
+   private:
+    Arena& mArena;
+    const size_t mScopeStart;
+};
+}  // namespace Moon
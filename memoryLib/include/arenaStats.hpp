@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Moon
+{
+
+// Request counters are only maintained when MOON_ARENA_STATS is defined (on by
+// default in Debug builds, see memoryLib/CMakeLists.txt), so release builds
+// keep them off the allocation path. Everything else is computed on demand by
+// Arena::GetStats().
+#ifdef MOON_ARENA_STATS
+inline constexpr bool ARENA_STATS_ENABLED = true;
+#else
+inline constexpr bool ARENA_STATS_ENABLED = false;
+#endif
+
+struct ArenaCounters
+{
+    // Requests served by reusing a released chunk
+    uint64_t mRequestHits = 0;
+    // Requests that had to carve a new chunk, including those needing a new block
+    uint64_t mRequestMisses = 0;
+    uint64_t mNewBlocks = 0;
+};
+
+struct ArenaBlockStats
+{
+    uint64_t mCapacity = 0;
+    uint64_t mOffset = 0;
+    uint64_t mChunkCount = 0;
+    uint64_t mUsedChunkCount = 0;
+    uint64_t mUsedChunkBytes = 0;
+    uint64_t mFreeChunkBytes = 0;
+    uint64_t mLargestFreeChunk = 0;
+};
+
+struct ArenaStats
+{
+    // Bucket i counts chunks with a capacity in [2^i, 2^(i+1))
+    static constexpr size_t HISTOGRAM_BUCKETS = 64;
+
+    std::vector<ArenaBlockStats> mBlocks;
+    std::array<uint64_t, HISTOGRAM_BUCKETS> mChunkSizeHistogram{};
+
+    uint64_t mTotalCapacity = 0;
+    uint64_t mUsedChunkBytes = 0;
+    uint64_t mFreeChunkBytes = 0;
+    // Bytes not yet carved into chunks
+    uint64_t mBumpBytes = 0;
+    uint64_t mHeaderOverheadBytes = 0;
+    uint64_t mLargestFreeChunk = 0;
+
+    ArenaCounters mCounters;
+
+    // Share of the mapped bytes handed out as used chunks
+    double GetUtilisation() const;
+    // 1 - largest free chunk / all free chunk bytes, 0 when there is no free chunk
+    double GetFragmentation() const;
+
+    std::string ToJson() const;
+
+    static size_t GetHistogramBucket(const uint64_t chunkSize);
+};
+}  // namespace Moon
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <MemoryLib/arena.hpp>
+#include <MemoryLib/arenaChunk.hpp>
+#include <MemoryLib/arenaChunkHeader.hpp>
+#include <MemoryLib/arenaConfig.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Moon::Test
+{
+class ConcurrentArenaFixture;
+}  // namespace Moon::Test
+
+namespace Moon
+{
+
+struct ConcurrentArenaThreadCaches;
+
+// Arena that can be shared between threads. Every thread allocates from its
+// own Arena, so the hot path takes no lock. A chunk released by another thread
+// is pushed onto the owner's lock-free remote free list, which the owner
+// drains on its next request. A thread finds its Arena in a thread_local map
+// keyed by arena id, so a lock is only taken the first time a thread touches
+// the arena and when the thread exits.
+//
+// At most MAX_THREAD_CACHES threads can request from the arena at the same
+// time, RequestChunk throws std::runtime_error for the next one. A thread that
+// only releases chunks takes no Arena and never throws. The Arena of an
+// exited thread is drained and handed to the next thread that touches the
+// arena, together with the chunks still alive in it. Chunks released into it
+// before then go straight back to it under the registry lock.
+class ConcurrentArena
+{
+   public:
+    static constexpr size_t MAX_THREAD_CACHES = 256;
+
+    ConcurrentArena(const size_t minAllocationSize, const ArenaConfig& config = ArenaConfig());
+    ConcurrentArena(const ConcurrentArena&) = delete;
+    ConcurrentArena(ConcurrentArena&&) = delete;
+    ConcurrentArena& operator=(const ConcurrentArena&) = delete;
+    ConcurrentArena& operator=(ConcurrentArena&&) = delete;
+    ~ConcurrentArena();
+
+    ArenaChunk* RequestChunk(const size_t size,
+                             const size_t alignment = ArenaMemoryBlock::SIZE_ALIGNMENT);
+    void ReleaseChunk(ArenaChunk* arenaChunk);
+
+    size_t GetDefaultAllocationSize() const
+    {
+        return mDefaultAllocationSize;
+    }
+
+   private:
+    struct ThreadCache
+    {
+        ThreadCache(const uint16_t id, const size_t minAllocationSize, const ArenaConfig& config)
+            : mId(id), mArena(minAllocationSize, config)
+        {
+        }
+
+        const uint16_t mId;
+        Arena mArena;
+        // Intrusive stack linked through the data of the released chunks
+        alignas(64) std::atomic<ArenaChunkHeader*> mRemoteFrees{nullptr};
+        // Set while no thread owns the cache, mArena is then only used under
+        // mRegistryMutex
+        std::atomic<bool> mOrphaned{false};
+    };
+
+    ThreadCache& GetThreadCache();
+    // Adopts an orphaned cache or creates a new one
+    ThreadCache& RegisterThreadCache();
+    // Called when the owning thread exits
+    void OrphanThreadCache(ThreadCache& cache);
+    void DrainRemoteFrees(ThreadCache& cache);
+    static ArenaChunkHeader*& NextRemoteFree(ArenaChunkHeader* chunkHeader);
+
+    friend struct ConcurrentArenaThreadCaches;
+
+   private:
+    const uint64_t mId;
+    const size_t mDefaultAllocationSize;
+    const ArenaConfig mConfig;
+
+    std::array<std::atomic<ThreadCache*>, MAX_THREAD_CACHES> mCaches{};
+    std::mutex mRegistryMutex;
+    // Owns every cache, indexed by cache id
+    std::vector<std::unique_ptr<ThreadCache>> mCacheStorage;
+    // Ids of the caches whose thread has exited
+    std::vector<uint16_t> mOrphanedCaches;
+
+    friend class Moon::Test::ConcurrentArenaFixture;
+};
+}  // namespace Moon
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace Moon
+{
+
+// Byte budget that any number of arenas and allocators can share, also across
+// threads. Charging costs one relaxed atomic add, so it can stay enabled in
+// production. The pressure callback runs on the thread whose charge crosses
+// the soft limit, e.g. to evict caches, and is not called again until usage
+// has dropped back below it.
+class MemoryBudget
+{
+   public:
+    using PressureCallback = std::function<void(const MemoryBudget&)>;
+
+    // A limit of 0 disables it
+    explicit MemoryBudget(const size_t hardLimit, const size_t softLimit = 0,
+                          PressureCallback onPressure = PressureCallback())
+        : mHardLimit(hardLimit), mSoftLimit(softLimit), mOnPressure(std::move(onPressure))
+    {
+    }
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget(MemoryBudget&&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(MemoryBudget&&) = delete;
+
+    // Charges nothing and returns false if the hard limit would be exceeded.
+    // Concurrent charges close to the limit may both fail.
+    bool TryCharge(const size_t bytes)
+    {
+        const size_t used = mUsed.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        if (mHardLimit != 0 && used > mHardLimit)
+        {
+            mUsed.fetch_sub(bytes, std::memory_order_relaxed);
+            return false;
+        }
+        if (mSoftLimit != 0 && used > mSoftLimit && used - bytes <= mSoftLimit)
+        {
+            NotifyPressure();
+        }
+        return true;
+    }
+
+    // Throws std::bad_alloc instead of returning false
+    void Charge(const size_t bytes);
+
+    void Release(const size_t bytes)
+    {
+        mUsed.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    size_t GetUsed() const
+    {
+        return mUsed.load(std::memory_order_relaxed);
+    }
+    size_t GetHardLimit() const
+    {
+        return mHardLimit;
+    }
+    size_t GetSoftLimit() const
+    {
+        return mSoftLimit;
+    }
+
+   private:
+    void NotifyPressure();
+
+   private:
+    std::atomic<size_t> mUsed{0};
+    const size_t mHardLimit;
+    const size_t mSoftLimit;
+    PressureCallback mOnPressure;
+};
+}  // namespace Moon
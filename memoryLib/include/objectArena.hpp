@@ -0,0 +1,67 @@
+#pragma once
+
+#include <MemoryLib/arena.hpp>
+#include <MemoryLib/arenaConfig.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Moon
+{
+
+// Arena of same-type objects. Objects are placed back to back in runs carved
+// from Arena chunks and are never destroyed one by one: the destructor (or
+// Clear) destroys every object in creation order in a single sweep, and skips
+// the sweep entirely for trivially destructible T.
+template <typename T>
+class ObjectArena
+{
+   public:
+    explicit ObjectArena(const size_t objectsPerRun = DEFAULT_OBJECTS_PER_RUN,
+                         const ArenaConfig& config = ArenaConfig());
+    ObjectArena(const ObjectArena&) = delete;
+    ObjectArena(ObjectArena&&) = delete;
+    ObjectArena& operator=(const ObjectArena&) = delete;
+    ObjectArena& operator=(ObjectArena&&) = delete;
+    ~ObjectArena();
+
+    template <typename... Args>
+    T* Create(Args&&... args);
+
+    // Constructs n contiguous objects from the same arguments and returns the
+    // first. If a constructor throws, the objects built so far are destroyed.
+    template <typename... Args>
+    T* CreateN(const size_t n, const Args&... args);
+
+    // Destroys every object, the memory is kept for reuse
+    void Clear();
+
+    size_t Size() const noexcept;
+
+   public:
+    static constexpr size_t DEFAULT_OBJECTS_PER_RUN = 1024;
+
+   private:
+    struct Run
+    {
+        T* mObjects;
+        size_t mCount;
+        size_t mCapacity;
+    };
+
+    // Returns room for n objects, starting a new run if the current one is full
+    T* Reserve(const size_t n);
+
+   private:
+    static constexpr size_t RUN_ALIGNMENT =
+        alignof(T) > ArenaMemoryBlock::SIZE_ALIGNMENT ? alignof(T)
+                                                      : ArenaMemoryBlock::SIZE_ALIGNMENT;
+
+    size_t mObjectsPerRun;
+    size_t mSize;
+    Arena mArena;
+    std::vector<Run> mRuns;
+};
+}  // namespace Moon
+
+#include <MemoryLib/objectArena.ipp>
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <MemoryLib/objectArena.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Moon
+{
+
+template <typename T>
+ObjectArena<T>::ObjectArena(const size_t objectsPerRun, const ArenaConfig& config)
+    : mObjectsPerRun(std::max<size_t>(objectsPerRun, 1)),
+      mSize(0),
+      mArena(ArenaMemoryBlock::CalcTotalAllocationSize(mObjectsPerRun * sizeof(T)), config)
+{
+}
+
+template <typename T>
+ObjectArena<T>::~ObjectArena()
+{
+    Clear();
+}
+
+template <typename T>
+template <typename... Args>
+T* ObjectArena<T>::Create(Args&&... args)
+{
+    T* ptr = Reserve(1);
+    new (ptr) T(std::forward<Args>(args)...);
+    ++mRuns.back().mCount;
+    ++mSize;
+    return ptr;
+}
+
+template <typename T>
+template <typename... Args>
+T* ObjectArena<T>::CreateN(const size_t n, const Args&... args)
+{
+    if (n == 0)
+    {
+        return nullptr;
+    }
+
+    T* first = Reserve(n);
+    size_t constructed = 0;
+    try
+    {
+        for (; constructed < n; ++constructed)
+        {
+            new (first + constructed) T(args...);
+        }
+    }
+    catch (...)
+    {
+        std::destroy_n(first, constructed);
+        throw;
+    }
+    mRuns.back().mCount += n;
+    mSize += n;
+    return first;
+}
+
+template <typename T>
+void ObjectArena<T>::Clear()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (auto& run : mRuns)
+        {
+            std::destroy_n(run.mObjects, run.mCount);
+        }
+    }
+    mRuns.clear();
+    mSize = 0;
+    mArena.Reset();
+}
+
+template <typename T>
+size_t ObjectArena<T>::Size() const noexcept
+{
+    return mSize;
+}
+
+template <typename T>
+T* ObjectArena<T>::Reserve(const size_t n)
+{
+    if (!mRuns.empty())
+    {
+        auto& run = mRuns.back();
+        if (run.mCapacity - run.mCount >= n)
+        {
+            return run.mObjects + run.mCount;
+        }
+    }
+
+    // The tail of a full run is left unused, runs are never revisited
+    const size_t capacity = std::max(mObjectsPerRun, n);
+    auto* chunk = mArena.RequestChunk(capacity * sizeof(T), RUN_ALIGNMENT);
+    mRuns.push_back(Run{static_cast<T*>(chunk->GetData()), 0, capacity});
+    return mRuns.back().mObjects;
+}
+}  // namespace Moon
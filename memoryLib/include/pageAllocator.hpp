@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Moon
+{
+
+// Thin wrapper over mmap/madvise, every size is expected to be page aligned
+class PageAllocator
+{
+   public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    static size_t GetPageSize();
+
+    // Throws std::bad_alloc if the mapping fails. With useHugePages the size
+    // must be HUGE_PAGE_SIZE aligned, MAP_HUGETLB is tried first and
+    // MADV_HUGEPAGE is used as a fallback.
+    static std::byte* Map(const size_t size, const bool useHugePages = false);
+    static void Unmap(std::byte* ptr, const size_t size);
+
+    // Shared read/write mapping of the first size bytes of an open file,
+    // throws std::bad_alloc if the mapping fails
+    static std::byte* MapFile(const int fd, const size_t size);
+    // Private read-only mapping of the first size bytes of a file opened for
+    // reading, throws std::bad_alloc if the mapping fails
+    static const std::byte* MapFileReadOnly(const int fd, const size_t size);
+    // Blocks until the dirty pages of a file mapping are written back
+    static void Sync(std::byte* ptr, const size_t size);
+
+    // Hands the physical pages back to the OS, the range stays mapped and
+    // reads back as zeroes
+    static void Discard(std::byte* ptr, const size_t size);
+};
+}  // namespace Moon
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Moon
+{
+
+// Pointer stored as the distance from its own address, so a structure linked
+// through RelativePtrs stays valid when its memory is mapped at another address.
+// Copying re-targets the distance to the new location.
+template <typename T>
+class RelativePtr
+{
+   public:
+    RelativePtr() : mOffset(NULL_OFFSET) {}
+    explicit RelativePtr(T* ptr)
+    {
+        Set(ptr);
+    }
+    RelativePtr(const RelativePtr& other)
+    {
+        Set(other.Get());
+    }
+    RelativePtr& operator=(const RelativePtr& other)
+    {
+        Set(other.Get());
+        return *this;
+    }
+    RelativePtr& operator=(T* ptr)
+    {
+        Set(ptr);
+        return *this;
+    }
+
+    T* Get() const
+    {
+        if (mOffset == NULL_OFFSET)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(reinterpret_cast<std::intptr_t>(this) + mOffset);
+    }
+    T* operator->() const
+    {
+        return Get();
+    }
+    T& operator*() const
+    {
+        return *Get();
+    }
+    operator T*() const
+    {
+        return Get();
+    }
+
+   private:
+    void Set(T* ptr)
+    {
+        mOffset = ptr ? reinterpret_cast<std::intptr_t>(ptr) - reinterpret_cast<std::intptr_t>(this)
+                      : NULL_OFFSET;
+    }
+
+   private:
+    // 0 is taken by self loops, the distance between a RelativePtr and an
+    // 8 byte aligned target is never 1
+    static constexpr std::intptr_t NULL_OFFSET = 1;
+    std::intptr_t mOffset;
+};
+}  // namespace Moon
@@ -0,0 +1,23 @@
+#include <MemoryLib/memoryBudget.hpp>
+
+#include <new>
+
+namespace Moon
+{
+
+void MemoryBudget::Charge(const size_t bytes)
+{
+    if (!TryCharge(bytes))
+    {
+        throw std::bad_alloc();
+    }
+}
+
+void MemoryBudget::NotifyPressure()
+{
+    if (mOnPressure)
+    {
+        mOnPressure(*this);
+    }
+}
+}  // namespace Moon
@@ -0,0 +1 @@
+#include <MemoryLib/objectArena.hpp>
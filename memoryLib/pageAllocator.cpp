@@ -0,0 +1,84 @@
+#include <MemoryLib/pageAllocator.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <new>
+
+namespace Moon
+{
+
+size_t PageAllocator::GetPageSize()
+{
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+std::byte* PageAllocator::Map(const size_t size, const bool useHugePages)
+{
+    constexpr int protection = PROT_READ | PROT_WRITE;
+    constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_HUGETLB
+    if (useHugePages)
+    {
+        void* ptr = mmap(nullptr, size, protection, flags | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+        {
+            return static_cast<std::byte*>(ptr);
+        }
+        // No reserved huge pages, fall back to transparent huge pages
+    }
+#endif
+
+    void* ptr = mmap(nullptr, size, protection, flags, -1, 0);
+    if (ptr == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (useHugePages)
+    {
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    return static_cast<std::byte*>(ptr);
+}
+
+void PageAllocator::Unmap(std::byte* ptr, const size_t size)
+{
+    munmap(ptr, size);
+}
+
+std::byte* PageAllocator::MapFile(const int fd, const size_t size)
+{
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+    return static_cast<std::byte*>(ptr);
+}
+
+const std::byte* PageAllocator::MapFileReadOnly(const int fd, const size_t size)
+{
+    void* ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+    return static_cast<const std::byte*>(ptr);
+}
+
+void PageAllocator::Sync(std::byte* ptr, const size_t size)
+{
+    msync(ptr, size, MS_SYNC);
+}
+
+void PageAllocator::Discard(std::byte* ptr, const size_t size)
+{
+    madvise(ptr, size, MADV_DONTNEED);
+}
+}  // namespace Moon
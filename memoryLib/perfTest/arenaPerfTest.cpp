@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <MemoryLib/arena.hpp>
+#include <MemoryLib/arenaScope.hpp>
+#include <MemoryLib/objectArena.hpp>
+
+#include <memory>
+#include <vector>
+
+static void BlockCountArguments(benchmark::internal::Benchmark* b)
+{
+    b->Arg(100)->Arg(1000)->Arg(10000)->Arg(50000);
+}
+
+static size_t GetChunkSize()
+{
+    return Moon::PageAllocator::GetPageSize() * 7 / 8;
+}
+
+// Fills an arena with one nearly full block per chunk, so every further
+// request has to pick a block among `blockCount` candidates
+static std::vector<Moon::ArenaChunk*> FillArena(Moon::Arena& arena, const size_t blockCount)
+{
+    std::vector<Moon::ArenaChunk*> chunks;
+    chunks.reserve(blockCount);
+    for (size_t i = 0; i < blockCount; ++i)
+    {
+        chunks.push_back(arena.RequestChunk(GetChunkSize()));
+    }
+    return chunks;
+}
+
+static Moon::ArenaConfig FixedBlockSizeConfig()
+{
+    Moon::ArenaConfig config;
+    config.mBlockGrowthFactor = 1;
+    return config;
+}
+
+static void BM_ArenaRequestReleaseLastBlock(benchmark::State& state)
+{
+    Moon::Arena arena(Moon::PageAllocator::GetPageSize(), FixedBlockSizeConfig());
+    auto chunks = FillArena(arena, state.range(0));
+    auto* lastChunk = chunks.back();
+
+    for (auto _ : state)
+    {
+        arena.ReleaseChunk(lastChunk);
+        lastChunk = arena.RequestChunk(GetChunkSize());
+        benchmark::DoNotOptimize(lastChunk);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ArenaRequestReleaseRandomBlock(benchmark::State& state)
+{
+    Moon::Arena arena(Moon::PageAllocator::GetPageSize(), FixedBlockSizeConfig());
+    auto chunks = FillArena(arena, state.range(0));
+    size_t index = 0;
+
+    for (auto _ : state)
+    {
+        index = (index * 1103515245 + 12345) % chunks.size();
+        arena.ReleaseChunk(chunks[index]);
+        chunks[index] = arena.RequestChunk(GetChunkSize());
+        benchmark::DoNotOptimize(chunks[index]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ArenaRequestNewBlock(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Moon::Arena arena(Moon::PageAllocator::GetPageSize(), FixedBlockSizeConfig());
+        auto chunks = FillArena(arena, state.range(0));
+        benchmark::DoNotOptimize(chunks.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Simulates a request handler recycling a warm arena
+static void BM_ArenaScopePerRequest(benchmark::State& state)
+{
+    Moon::Arena arena(64 * 1024);
+    for (auto _ : state)
+    {
+        Moon::ArenaScope scope(arena);
+        for (int i = 0; i < state.range(0); ++i)
+        {
+            benchmark::DoNotOptimize(arena.RequestChunk(64 + (i % 8) * 32));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+struct GraphNode
+{
+    GraphNode* mNeighbours[4] = {};
+    std::unique_ptr<int> mPayload;
+};
+
+// Baseline for BM_ObjectArenaCreateN, one new and one delete per object
+static void BM_NewDeleteObjects(benchmark::State& state)
+{
+    std::vector<GraphNode*> nodes(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto& node : nodes)
+        {
+            node = new GraphNode();
+        }
+        benchmark::DoNotOptimize(nodes.data());
+        for (auto* node : nodes)
+        {
+            delete node;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ObjectArenaCreateN(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Moon::ObjectArena<GraphNode> arena(4096);
+        for (int i = 0; i < state.range(0); i += 256)
+        {
+            benchmark::DoNotOptimize(arena.CreateN(256));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ArenaRequestReleaseLastBlock)->Apply(BlockCountArguments);
+BENCHMARK(BM_ArenaRequestReleaseRandomBlock)->Apply(BlockCountArguments);
+BENCHMARK(BM_ArenaRequestNewBlock)->Apply(BlockCountArguments);
+BENCHMARK(BM_ArenaScopePerRequest)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_NewDeleteObjects)->Arg(1 << 14)->Arg(1 << 18);
+BENCHMARK(BM_ObjectArenaCreateN)->Arg(1 << 14)->Arg(1 << 18);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <MemoryLib/concurrentArena.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+static constexpr size_t CHUNK_SIZE = 128;
+static constexpr size_t LIVE_CHUNKS = 64;
+
+// Baseline: a single Arena shared behind a mutex
+static Moon::Arena* lockedArena = nullptr;
+static std::mutex lockedArenaMutex;
+
+static Moon::ConcurrentArena* concurrentArena = nullptr;
+
+// Per-thread slots for chunks released by the neighbouring thread
+static std::vector<Moon::ArenaChunk*> handoffSlots(32 * LIVE_CHUNKS);
+
+static void BM_LockedArenaRequestRelease(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        lockedArena = new Moon::Arena(64 * 1024);
+    }
+
+    std::vector<Moon::ArenaChunk*> chunks(LIVE_CHUNKS, nullptr);
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> lock(lockedArenaMutex);
+        lockedArena->ReleaseChunk(chunks[index]);
+        chunks[index] = lockedArena->RequestChunk(CHUNK_SIZE);
+        index = (index + 1) % LIVE_CHUNKS;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        delete lockedArena;
+    }
+}
+
+static void BM_ConcurrentArenaRequestRelease(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        concurrentArena = new Moon::ConcurrentArena(64 * 1024);
+    }
+
+    std::vector<Moon::ArenaChunk*> chunks(LIVE_CHUNKS, nullptr);
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        concurrentArena->ReleaseChunk(chunks[index]);
+        chunks[index] = concurrentArena->RequestChunk(CHUNK_SIZE);
+        index = (index + 1) % LIVE_CHUNKS;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        delete concurrentArena;
+    }
+}
+
+// Every chunk is released by the next thread, exercising the remote free lists
+static void BM_ConcurrentArenaCrossThreadRelease(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        concurrentArena = new Moon::ConcurrentArena(64 * 1024);
+    }
+
+    const size_t threads = state.threads();
+    const size_t neighbour = (state.thread_index() + 1) % threads;
+    auto* mySlots = &handoffSlots[state.thread_index() * LIVE_CHUNKS];
+    auto* neighbourSlots = &handoffSlots[neighbour * LIVE_CHUNKS];
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        auto* chunk = concurrentArena->RequestChunk(CHUNK_SIZE);
+        auto* previous = __atomic_exchange_n(&mySlots[index], chunk, __ATOMIC_ACQ_REL);
+        concurrentArena->ReleaseChunk(previous);
+        auto* stolen = __atomic_exchange_n(&neighbourSlots[index], nullptr, __ATOMIC_ACQ_REL);
+        concurrentArena->ReleaseChunk(stolen);
+        index = (index + 1) % LIVE_CHUNKS;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        std::fill(handoffSlots.begin(), handoffSlots.end(), nullptr);
+        delete concurrentArena;
+    }
+}
+
+// One thread switching between several arenas, e.g. one per subsystem
+static void BM_ConcurrentArenaAlternatingArenas(benchmark::State& state)
+{
+    std::vector<std::unique_ptr<Moon::ConcurrentArena>> arenas;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        arenas.push_back(std::make_unique<Moon::ConcurrentArena>(64 * 1024));
+    }
+
+    std::vector<Moon::ArenaChunk*> chunks(LIVE_CHUNKS, nullptr);
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        auto& arena = *arenas[index % arenas.size()];
+        arena.ReleaseChunk(chunks[index]);
+        chunks[index] = arena.RequestChunk(CHUNK_SIZE);
+        index = (index + 1) % LIVE_CHUNKS;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_LockedArenaRequestRelease)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentArenaRequestRelease)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentArenaCrossThreadRelease)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentArenaAlternatingArenas)->Arg(1)->Arg(2)->Arg(4);
+
+BENCHMARK_MAIN();
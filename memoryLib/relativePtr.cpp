@@ -0,0 +1 @@
+#include <MemoryLib/relativePtr.hpp>
@@ -0,0 +1,67 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <MemoryLib/arenaBlockIndex.hpp>
+
+namespace Moon::Test
+{
+
+TEST(ArenaBlockIndexTest, WHEN_index_is_empty_THEN_npos_is_returned)
+{
+    ArenaBlockIndex index;
+    EXPECT_EQ(ArenaBlockIndex::NPOS, index.FindFirstAtLeast(1));
+    EXPECT_EQ(0, index.Size());
+}
+
+TEST(ArenaBlockIndexTest, WHEN_values_are_pushed_THEN_first_index_at_least_value_is_returned)
+{
+    ArenaBlockIndex index;
+    index.PushBack(100);
+    index.PushBack(500);
+    index.PushBack(200);
+    index.PushBack(800);
+    index.PushBack(300);
+
+    EXPECT_EQ(5, index.Size());
+    EXPECT_EQ(0, index.FindFirstAtLeast(50));
+    EXPECT_EQ(1, index.FindFirstAtLeast(101));
+    EXPECT_EQ(1, index.FindFirstAtLeast(500));
+    EXPECT_EQ(3, index.FindFirstAtLeast(501));
+    EXPECT_EQ(ArenaBlockIndex::NPOS, index.FindFirstAtLeast(801));
+}
+
+TEST(ArenaBlockIndexTest, WHEN_value_is_updated_THEN_search_reflects_new_value)
+{
+    ArenaBlockIndex index;
+    for (size_t i = 0; i < 9; ++i)
+    {
+        index.PushBack(10);
+    }
+
+    EXPECT_EQ(ArenaBlockIndex::NPOS, index.FindFirstAtLeast(20));
+    index.Update(7, 20);
+    EXPECT_EQ(7, index.FindFirstAtLeast(20));
+    EXPECT_EQ(20, index.Get(7));
+    index.Update(2, 30);
+    EXPECT_EQ(2, index.FindFirstAtLeast(20));
+    index.Update(2, 0);
+    EXPECT_EQ(7, index.FindFirstAtLeast(20));
+    EXPECT_EQ(0, index.FindFirstAtLeast(10));
+}
+
+TEST(ArenaBlockIndexTest, WHEN_index_grows_THEN_existing_values_are_kept)
+{
+    ArenaBlockIndex index;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        index.PushBack(i);
+    }
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(i, index.Get(i));
+        EXPECT_EQ(i, index.FindFirstAtLeast(i));
+    }
+}
+
+}  // namespace Moon::Test
@@ -0,0 +1,172 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <MemoryLib/arenaImage.hpp>
+#include <MemoryLib/relativePtr.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+namespace Moon::Test
+{
+
+struct ImageNode
+{
+    int mValue;
+    RelativePtr<ImageNode> mNext;
+};
+
+class ArenaImageFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+        mPath = (std::filesystem::temp_directory_path() /
+                 ("moon_arena_image_" + std::to_string(getpid()) + ".img"))
+                    .string();
+    }
+
+    void TearDown() override
+    {
+        std::remove(mPath.c_str());
+    }
+
+    // Builds a list 0 -> 1 -> ... -> count - 1 and makes its head the root
+    void BuildList(ArenaImage& image, const int count)
+    {
+        ImageNode* prev = nullptr;
+        for (int i = 0; i < count; ++i)
+        {
+            auto* node = new (image.RequestChunk(sizeof(ImageNode))->GetData()) ImageNode();
+            node->mValue = i;
+            if (prev)
+            {
+                prev->mNext = node;
+            }
+            else
+            {
+                image.SetRoot(node);
+            }
+            prev = node;
+        }
+    }
+
+    void ExpectList(const ArenaImage& image, const int count)
+    {
+        auto* node = static_cast<ImageNode*>(image.GetRoot());
+        for (int i = 0; i < count; ++i)
+        {
+            ASSERT_NE(node, nullptr);
+            EXPECT_EQ(node->mValue, i);
+            node = node->mNext;
+        }
+        EXPECT_EQ(node, nullptr);
+    }
+
+    std::string mPath;
+};
+
+TEST(RelativePtrTest, WHEN_relative_ptr_is_copied_THEN_it_points_to_the_same_target)
+{
+    int target = 0;
+    RelativePtr<int> ptr;
+    EXPECT_EQ(ptr, nullptr);
+
+    ptr = &target;
+    auto copy = std::make_unique<RelativePtr<int>>(ptr);
+    EXPECT_EQ(ptr.Get(), &target);
+    EXPECT_EQ(copy->Get(), &target);
+
+    ptr = nullptr;
+    EXPECT_EQ(ptr.Get(), nullptr);
+}
+
+TEST_F(ArenaImageFixture, WHEN_image_is_created_THEN_chunks_are_served_until_it_is_full)
+{
+    ArenaImage image(mPath, 4096);
+    EXPECT_GE(image.GetCapacity(), 4096 - ArenaImage::HEADER_SIZE);
+    EXPECT_EQ(image.GetRoot(), nullptr);
+
+    size_t served = 0;
+    while (image.RequestChunk(512))
+    {
+        served += 512;
+    }
+    EXPECT_GT(served, 0);
+    EXPECT_LE(served, image.GetCapacity());
+}
+
+TEST_F(ArenaImageFixture, WHEN_chunk_is_released_THEN_it_is_reused)
+{
+    ArenaImage image(mPath, 4096);
+    auto* chunk1 = image.RequestChunk(256);
+    auto* chunk2 = image.RequestChunk(256);
+    image.ReleaseChunk(chunk1);
+
+    EXPECT_EQ(image.RequestChunk(200), chunk1);
+    EXPECT_NE(chunk2, nullptr);
+}
+
+TEST_F(ArenaImageFixture, WHEN_image_is_reopened_THEN_root_and_links_are_restored)
+{
+    {
+        ArenaImage image(mPath, 64 * 1024);
+        BuildList(image, 100);
+    }
+
+    ArenaImage reopened(mPath);
+    ExpectList(reopened, 100);
+}
+
+TEST_F(ArenaImageFixture, WHEN_image_is_mapped_at_another_address_THEN_no_fix_up_is_needed)
+{
+    ArenaImage image(mPath, 64 * 1024);
+    BuildList(image, 10);
+    image.Flush();
+
+    // Both mappings are alive, so the second one cannot share the address
+    ArenaImage second(mPath);
+    EXPECT_NE(second.GetRoot(), image.GetRoot());
+    ExpectList(second, 10);
+}
+
+TEST_F(ArenaImageFixture, WHEN_image_is_reopened_THEN_free_chunks_and_bump_space_are_kept)
+{
+    ArenaChunk* released = nullptr;
+    size_t remaining = 0;
+    {
+        ArenaImage image(mPath, 64 * 1024);
+        image.RequestChunk(128);
+        released = image.RequestChunk(1024);
+        image.RequestChunk(128);
+        image.ReleaseChunk(released);
+        remaining = image.GetRemainingSize();
+    }
+
+    ArenaImage reopened(mPath);
+    EXPECT_EQ(reopened.GetRemainingSize(), remaining);
+    auto* reused = reopened.RequestChunk(1000);
+    ASSERT_NE(reused, nullptr);
+    EXPECT_GE(reused->GetCapacity(), 1000);
+    EXPECT_EQ(reopened.GetRemainingSize(), remaining);
+}
+
+TEST_F(ArenaImageFixture, WHEN_file_is_not_an_image_THEN_open_throws)
+{
+    {
+        std::ofstream file(mPath);
+        file << std::string(4096, 'x');
+    }
+    EXPECT_THROW(ArenaImage image(mPath), std::runtime_error);
+    EXPECT_THROW(ArenaImage image(mPath + ".missing"), std::runtime_error);
+}
+
+}  // namespace Moon::Test
@@ -0,0 +1,98 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <MemoryLib/arena.hpp>
+#include <MemoryLib/arenaStats.hpp>
+
+namespace Moon::Test
+{
+
+TEST(ArenaStatsTest, WHEN_arena_is_empty_THEN_stats_are_zero)
+{
+    Arena arena(4096);
+    const auto stats = arena.GetStats();
+
+    EXPECT_TRUE(stats.mBlocks.empty());
+    EXPECT_EQ(stats.mTotalCapacity, 0);
+    EXPECT_EQ(stats.GetUtilisation(), 0.0);
+    EXPECT_EQ(stats.GetFragmentation(), 0.0);
+}
+
+TEST(ArenaStatsTest, WHEN_chunks_are_used_and_released_THEN_byte_totals_add_up)
+{
+    Arena arena(PageAllocator::GetPageSize());
+    auto* chunk1 = arena.RequestChunk(100);
+    auto* chunk2 = arena.RequestChunk(300);
+    arena.RequestChunk(200);
+    arena.ReleaseChunk(chunk2);
+
+    const auto stats = arena.GetStats();
+    ASSERT_EQ(stats.mBlocks.size(), 1);
+    const auto& block = stats.mBlocks[0];
+    EXPECT_EQ(block.mCapacity, PageAllocator::GetPageSize());
+    EXPECT_EQ(block.mChunkCount, 3);
+    EXPECT_EQ(block.mUsedChunkCount, 2);
+    EXPECT_EQ(block.mFreeChunkBytes, chunk2->GetCapacity());
+    EXPECT_EQ(block.mLargestFreeChunk, chunk2->GetCapacity());
+    EXPECT_EQ(stats.mHeaderOverheadBytes, 3 * sizeof(ArenaChunkHeader));
+    EXPECT_EQ(stats.mUsedChunkBytes + stats.mFreeChunkBytes + stats.mBumpBytes +
+                  stats.mHeaderOverheadBytes,
+              stats.mTotalCapacity);
+    EXPECT_GT(stats.GetUtilisation(), 0.0);
+    EXPECT_EQ(stats.GetFragmentation(), 0.0);
+
+    uint64_t histogramTotal = 0;
+    for (const auto count : stats.mChunkSizeHistogram)
+    {
+        histogramTotal += count;
+    }
+    EXPECT_EQ(histogramTotal, 3);
+    EXPECT_EQ(stats.mChunkSizeHistogram[ArenaStats::GetHistogramBucket(chunk1->GetCapacity())], 2);
+    EXPECT_EQ(stats.mChunkSizeHistogram[ArenaStats::GetHistogramBucket(chunk2->GetCapacity())], 1);
+}
+
+TEST(ArenaStatsTest, WHEN_histogram_bucket_is_computed_THEN_floor_log2_is_returned)
+{
+    EXPECT_EQ(ArenaStats::GetHistogramBucket(1), 0);
+    EXPECT_EQ(ArenaStats::GetHistogramBucket(24), 4);
+    EXPECT_EQ(ArenaStats::GetHistogramBucket(64), 6);
+    EXPECT_EQ(ArenaStats::GetHistogramBucket(65), 6);
+    EXPECT_EQ(ArenaStats::GetHistogramBucket(uint64_t{1} << 40), 40);
+}
+
+TEST(ArenaStatsTest, WHEN_requests_are_made_THEN_counters_track_hits_misses_and_new_blocks)
+{
+    if (!ARENA_STATS_ENABLED)
+    {
+        GTEST_SKIP() << "MOON_ARENA_STATS is not defined";
+    }
+
+    Arena arena(PageAllocator::GetPageSize());
+    auto* chunk = arena.RequestChunk(100);
+    arena.RequestChunk(100);
+    arena.ReleaseChunk(chunk);
+    arena.RequestChunk(100);
+    arena.RequestChunk(PageAllocator::GetPageSize() * 2);
+
+    const auto counters = arena.GetStats().mCounters;
+    EXPECT_EQ(counters.mRequestHits, 1);
+    EXPECT_EQ(counters.mRequestMisses, 3);
+    EXPECT_EQ(counters.mNewBlocks, 2);
+}
+
+TEST(ArenaStatsTest, WHEN_stats_are_dumped_THEN_json_contains_every_section)
+{
+    Arena arena(PageAllocator::GetPageSize());
+    arena.RequestChunk(100);
+
+    const auto json = arena.GetStats().ToJson();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_THAT(json, ::testing::HasSubstr("\"totalCapacity\":"));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"headerOverheadBytes\":40"));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"counters\":{"));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"chunkSizeHistogram\":[{\"minSize\":128,\"count\":1}]"));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"blocks\":[{\"capacity\":"));
+}
+
+}  // namespace Moon::Test
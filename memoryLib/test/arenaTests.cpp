@@ -3,6 +3,7 @@
 
 #include <CommonLib/math.hpp>
 #include <MemoryLib/arena.hpp>
+#include <MemoryLib/arenaScope.hpp>
 
 namespace Moon::Test
 {
@@ -38,7 +39,17 @@ class ArenaFixture : public ::testing::Test
         return static_cast<const ArenaChunkHeader*>(chunk)->mIsUsed;
     }
 
-    uint64_t mPageSize = 1024;
+    auto& GetBlockIndex(const Arena& arena)
+    {
+        return arena.mBlockIndex;
+    }
+
+    auto GetOffset(const ArenaMemoryBlock& block)
+    {
+        return block.mOffset;
+    }
+
+    uint64_t mPageSize = PageAllocator::GetPageSize();
 };
 
 TEST_F(ArenaFixture,
@@ -81,9 +92,9 @@ TEST_F(ArenaFixture,
 TEST_F(ArenaFixture,
        WHEN_request_chunk_with_insufficient_space_THEN_new_block_is_created)
 {
-    Arena arena(1024);
-    ArenaChunk* chunk1 = arena.RequestChunk(800);
-    ArenaChunk* chunk2 = arena.RequestChunk(800);
+    Arena arena(mPageSize);
+    ArenaChunk* chunk1 = arena.RequestChunk(mPageSize * 3 / 4);
+    ArenaChunk* chunk2 = arena.RequestChunk(mPageSize * 3 / 4);
 
     EXPECT_NE(chunk1, nullptr);
     EXPECT_NE(chunk2, nullptr);
@@ -148,4 +159,399 @@ TEST_F(ArenaFixture, WHEN_memory_block_is_destroyed_THEN_memory_is_freed)
     EXPECT_TRUE(true);
 }
 
+TEST_F(ArenaFixture,
+       WHEN_chunk_in_earlier_block_is_released_THEN_it_is_reused_before_later_blocks)
+{
+    ArenaConfig config;
+    config.mBlockGrowthFactor = 1;
+    Arena arena(mPageSize, config);
+    std::vector<ArenaChunk*> chunks;
+    for (int i = 0; i < 100; ++i)
+    {
+        chunks.push_back(arena.RequestChunk(mPageSize * 3 / 4));
+    }
+    EXPECT_EQ(GetMemoryBlocks(arena).size(), 100);
+
+    arena.ReleaseChunk(chunks[42]);
+    ArenaChunk* chunk = arena.RequestChunk(mPageSize * 3 / 4);
+
+    EXPECT_EQ(chunk, chunks[42]);
+    EXPECT_TRUE(IsChunkUsed(chunk));
+    EXPECT_EQ(GetMemoryBlocks(arena).size(), 100);
+}
+
+TEST_F(ArenaFixture,
+       WHEN_chunks_are_requested_and_released_THEN_block_index_matches_blocks)
+{
+    Arena arena(4096);
+    std::vector<ArenaChunk*> chunks;
+    for (int i = 0; i < 64; ++i)
+    {
+        chunks.push_back(arena.RequestChunk(64 + (i * 97) % 1500));
+    }
+    for (int i = 0; i < 64; i += 3)
+    {
+        arena.ReleaseChunk(chunks[i]);
+    }
+    for (int i = 0; i < 16; ++i)
+    {
+        arena.RequestChunk(32 + (i * 211) % 1200);
+    }
+
+    const auto& blocks = GetMemoryBlocks(arena);
+    const auto& blockIndex = GetBlockIndex(arena);
+    EXPECT_EQ(blockIndex.Size(), blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        EXPECT_EQ(blockIndex.Get(i), blocks[i].GetMaxRequestableSize());
+    }
+}
+
+TEST_F(ArenaFixture,
+       WHEN_request_fits_in_earlier_block_THEN_first_fitting_block_is_used)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* chunk1 = arena.RequestChunk(mPageSize - 256);
+    ArenaChunk* chunk2 = arena.RequestChunk(200);
+    ArenaChunk* chunk3 = arena.RequestChunk(64);
+
+    const auto& memoryBlocks = GetMemoryBlocks(arena);
+    EXPECT_EQ(memoryBlocks.size(), 2);
+    EXPECT_EQ(static_cast<ArenaChunkHeader*>(chunk1)->mBlockIndex, 0);
+    EXPECT_EQ(static_cast<ArenaChunkHeader*>(chunk2)->mBlockIndex, 1);
+    EXPECT_EQ(static_cast<ArenaChunkHeader*>(chunk3)->mBlockIndex, 0);
+}
+
+TEST_F(ArenaFixture, WHEN_blocks_are_created_THEN_capacity_is_page_aligned)
+{
+    Arena arena(1000);
+    arena.RequestChunk(mPageSize + 1);
+
+    const auto& memoryBlocks = GetMemoryBlocks(arena);
+    EXPECT_EQ(memoryBlocks.size(), 1);
+    EXPECT_EQ(memoryBlocks[0].GetCapacity() % mPageSize, 0);
+}
+
+TEST_F(ArenaFixture, WHEN_new_blocks_are_needed_THEN_block_size_grows_geometrically)
+{
+    ArenaConfig config;
+    config.mBlockGrowthFactor = 2;
+    config.mMaxBlockSize = mPageSize * 4;
+    Arena arena(mPageSize, config);
+    for (int i = 0; i < 20; ++i)
+    {
+        arena.RequestChunk(mPageSize * 3 / 4);
+    }
+
+    const auto& memoryBlocks = GetMemoryBlocks(arena);
+    ASSERT_GE(memoryBlocks.size(), 4);
+    EXPECT_EQ(memoryBlocks[0].GetCapacity(), mPageSize);
+    EXPECT_EQ(memoryBlocks[1].GetCapacity(), mPageSize * 2);
+    EXPECT_EQ(memoryBlocks[2].GetCapacity(), mPageSize * 4);
+    EXPECT_EQ(memoryBlocks[3].GetCapacity(), mPageSize * 4);
+}
+
+TEST_F(ArenaFixture, WHEN_all_chunks_of_a_block_are_released_THEN_block_is_rewound)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* chunk1 = arena.RequestChunk(128);
+    ArenaChunk* chunk2 = arena.RequestChunk(256);
+
+    const auto& memoryBlocks = GetMemoryBlocks(arena);
+    EXPECT_GT(GetOffset(memoryBlocks[0]), 0);
+
+    arena.ReleaseChunk(chunk1);
+    EXPECT_GT(GetOffset(memoryBlocks[0]), 0);
+    arena.ReleaseChunk(chunk2);
+    EXPECT_EQ(GetOffset(memoryBlocks[0]), 0);
+    EXPECT_EQ(GetChunkHeaders(memoryBlocks[0]), nullptr);
+
+    ArenaChunk* chunk3 = arena.RequestChunk(mPageSize / 2);
+    EXPECT_EQ(chunk3->GetData(), chunk1->GetData());
+}
+
+TEST_F(ArenaFixture, WHEN_free_blocks_are_released_to_os_THEN_memory_reads_back_as_zero)
+{
+    ArenaConfig config;
+    config.mReleaseFreeBlocks = true;
+    Arena arena(mPageSize, config);
+    ArenaChunk* chunk = arena.RequestChunk(256);
+    auto* data = static_cast<unsigned char*>(chunk->GetData());
+    data[0] = 0xAB;
+    data[255] = 0xCD;
+
+    arena.ReleaseChunk(chunk);
+
+    EXPECT_EQ(data[0], 0);
+    EXPECT_EQ(data[255], 0);
+}
+
+TEST_F(ArenaFixture, WHEN_arena_is_reset_THEN_blocks_are_kept_and_rewound)
+{
+    Arena arena(mPageSize);
+    for (int i = 0; i < 10; ++i)
+    {
+        arena.RequestChunk(mPageSize / 2);
+    }
+    const auto& memoryBlocks = GetMemoryBlocks(arena);
+    const auto blockCount = memoryBlocks.size();
+    const auto firstData = GetChunkHeaders(memoryBlocks[0])->GetData();
+
+    arena.Reset();
+
+    EXPECT_EQ(memoryBlocks.size(), blockCount);
+    for (const auto& block : memoryBlocks)
+    {
+        EXPECT_EQ(GetOffset(block), 0);
+        EXPECT_EQ(GetChunkHeaders(block), nullptr);
+    }
+    EXPECT_EQ(arena.RequestChunk(mPageSize / 2)->GetData(), firstData);
+    EXPECT_EQ(memoryBlocks.size(), blockCount);
+}
+
+TEST_F(ArenaFixture, WHEN_scope_ends_THEN_chunks_requested_inside_it_are_dropped)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* outer = arena.RequestChunk(128);
+    const auto& memoryBlocks = GetMemoryBlocks(arena);
+    const auto offset = GetOffset(memoryBlocks[0]);
+    {
+        ArenaScope scope(arena);
+        arena.RequestChunk(128);
+        arena.RequestChunk(256);
+        for (int i = 0; i < 8; ++i)
+        {
+            arena.RequestChunk(mPageSize / 2);
+        }
+        EXPECT_GT(memoryBlocks.size(), 1);
+    }
+
+    const auto blockCount = memoryBlocks.size();
+    EXPECT_EQ(GetOffset(memoryBlocks[0]), offset);
+    EXPECT_EQ(GetChunkHeaders(memoryBlocks[0]), outer);
+    EXPECT_EQ(outer->GetData(), static_cast<ArenaChunkHeader*>(outer)->mNext->GetData());
+    EXPECT_TRUE(IsChunkUsed(outer));
+    for (size_t i = 1; i < blockCount; ++i)
+    {
+        EXPECT_EQ(GetOffset(memoryBlocks[i]), 0);
+    }
+
+    // Blocks are kept warm for the next scope
+    {
+        ArenaScope scope(arena);
+        for (int i = 0; i < 8; ++i)
+        {
+            arena.RequestChunk(mPageSize / 2);
+        }
+    }
+    EXPECT_EQ(memoryBlocks.size(), blockCount);
+}
+
+TEST_F(ArenaFixture, WHEN_scopes_are_nested_THEN_each_scope_rolls_back_its_own_chunks)
+{
+    Arena arena(mPageSize * 4);
+    const auto& memoryBlocks = GetMemoryBlocks(arena);
+    arena.RequestChunk(64);
+    const auto offset0 = GetOffset(memoryBlocks[0]);
+    {
+        ArenaScope outerScope(arena);
+        arena.RequestChunk(64);
+        const auto offset1 = GetOffset(memoryBlocks[0]);
+        {
+            ArenaScope innerScope(arena);
+            arena.RequestChunk(64);
+            arena.RequestChunk(64);
+        }
+        EXPECT_EQ(GetOffset(memoryBlocks[0]), offset1);
+    }
+    EXPECT_EQ(GetOffset(memoryBlocks[0]), offset0);
+}
+
+TEST_F(ArenaFixture, WHEN_chunks_are_released_inside_scope_THEN_state_stays_consistent)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* before = arena.RequestChunk(128);
+    ArenaChunk* kept = arena.RequestChunk(128);
+    {
+        ArenaScope scope(arena);
+        ArenaChunk* inside = arena.RequestChunk(128);
+        arena.ReleaseChunk(inside);
+        arena.ReleaseChunk(before);
+        // The block is not rewound while a scope is open
+        EXPECT_GT(GetOffset(GetMemoryBlocks(arena)[0]), 0);
+    }
+
+    const auto& block = GetMemoryBlocks(arena)[0];
+    EXPECT_TRUE(block.HasUsedChunks());
+    EXPECT_FALSE(IsChunkUsed(before));
+    EXPECT_EQ(arena.RequestChunk(128), before);
+
+    arena.ReleaseChunk(before);
+    arena.ReleaseChunk(kept);
+    EXPECT_FALSE(block.HasUsedChunks());
+    EXPECT_EQ(GetOffset(block), 0);
+}
+
+TEST_F(ArenaFixture, WHEN_scope_reuses_a_free_chunk_from_before_it_THEN_chunk_is_freed_again)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* a = arena.RequestChunk(128);
+    ArenaChunk* b = arena.RequestChunk(128);
+    arena.ReleaseChunk(a);
+    const auto& block = GetMemoryBlocks(arena)[0];
+    {
+        ArenaScope scope(arena);
+        EXPECT_EQ(arena.RequestChunk(128), a);
+        {
+            ArenaScope innerScope(arena);
+            arena.ReleaseChunk(a);
+            EXPECT_EQ(arena.RequestChunk(128), a);
+        }
+        EXPECT_FALSE(IsChunkUsed(a));
+        EXPECT_EQ(arena.RequestChunk(128), a);
+    }
+
+    EXPECT_EQ(arena.GetStats().mBlocks[0].mUsedChunkCount, 1);
+    EXPECT_FALSE(IsChunkUsed(a));
+    EXPECT_TRUE(IsChunkUsed(b));
+    arena.ReleaseChunk(b);
+    EXPECT_FALSE(block.HasUsedChunks());
+    EXPECT_EQ(GetOffset(block), 0);
+}
+
+TEST_F(ArenaFixture, WHEN_last_chunk_is_extended_THEN_it_grows_in_place)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* chunk = arena.RequestChunk(100);
+    auto* data = static_cast<char*>(chunk->GetData());
+    data[0] = 'a';
+
+    ArenaChunk* extended = arena.TryExtendChunk(chunk, 1000);
+
+    ASSERT_NE(extended, nullptr);
+    EXPECT_EQ(extended->GetData(), data);
+    EXPECT_GE(extended->GetCapacity(), 1000);
+    EXPECT_EQ(data[0], 'a');
+    EXPECT_TRUE(IsChunkUsed(extended));
+
+    const auto& block = GetMemoryBlocks(arena)[0];
+    EXPECT_EQ(GetChunkHeaders(block), extended);
+    EXPECT_EQ(GetOffset(block), ArenaMemoryBlock::CalcTotalAllocationSize(1000));
+    EXPECT_EQ(GetBlockIndex(arena).Get(0), block.GetMaxRequestableSize());
+}
+
+TEST_F(ArenaFixture, WHEN_chunk_is_not_last_or_block_is_full_THEN_extension_fails)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* chunk1 = arena.RequestChunk(100);
+    ArenaChunk* chunk2 = arena.RequestChunk(100);
+
+    EXPECT_EQ(arena.TryExtendChunk(chunk1, 200), nullptr);
+    EXPECT_EQ(arena.TryExtendChunk(chunk2, mPageSize), nullptr);
+
+    ArenaChunk* extended = arena.TryExtendChunk(chunk2, 300);
+    ASSERT_NE(extended, nullptr);
+    EXPECT_EQ(static_cast<ArenaChunkHeader*>(chunk1)->mNext, extended);
+    EXPECT_EQ(static_cast<ArenaChunkHeader*>(extended)->mNext, chunk1);
+    EXPECT_EQ(static_cast<ArenaChunkHeader*>(chunk1)->mPrev, extended);
+}
+
+TEST_F(ArenaFixture, WHEN_chunk_predates_scope_THEN_it_is_not_extended_inside_scope)
+{
+    Arena arena(mPageSize);
+    ArenaChunk* before = arena.RequestChunk(100);
+    {
+        ArenaScope scope(arena);
+        EXPECT_EQ(arena.TryExtendChunk(before, 500), nullptr);
+
+        ArenaChunk* inside = arena.RequestChunk(100);
+        EXPECT_NE(arena.TryExtendChunk(inside, 500), nullptr);
+    }
+    EXPECT_EQ(GetOffset(GetMemoryBlocks(arena)[0]), ArenaMemoryBlock::CalcTotalAllocationSize(100));
+    EXPECT_NE(arena.TryExtendChunk(before, 500), nullptr);
+}
+
+TEST_F(ArenaFixture, WHEN_no_alignment_is_given_THEN_chunks_are_size_alignment_aligned)
+{
+    Arena arena(mPageSize);
+    for (size_t size : {1, 40, 100, 513})
+    {
+        auto* chunk = arena.RequestChunk(size);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(chunk->GetData()) % ArenaMemoryBlock::SIZE_ALIGNMENT, 0);
+    }
+}
+
+TEST_F(ArenaFixture, WHEN_chunk_is_over_aligned_THEN_padding_becomes_a_free_chunk)
+{
+    Arena arena(mPageSize * 4);
+    arena.RequestChunk(100);
+    auto* aligned = arena.RequestChunk(100, 1024);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned->GetData()) % 1024, 0);
+    EXPECT_EQ(GetMemoryBlocks(arena).size(), 1);
+
+    // The padding in front of the aligned chunk is handed out again
+    const auto paddingCapacity = 1024 - ArenaMemoryBlock::CalcTotalAllocationSize(100) -
+                                 sizeof(ArenaChunkHeader);
+    auto* reused = arena.RequestChunk(paddingCapacity);
+    EXPECT_EQ(static_cast<std::byte*>(reused->GetData()) +
+                  ArenaMemoryBlock::CalcTotalAllocationSize(paddingCapacity),
+              aligned->GetData());
+}
+
+TEST_F(ArenaFixture, WHEN_alignment_exceeds_page_size_THEN_new_block_leaves_room_for_padding)
+{
+    Arena arena(mPageSize);
+    const auto alignment = mPageSize * 4;
+    auto* aligned = arena.RequestChunk(mPageSize, alignment);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned->GetData()) % alignment, 0);
+
+    arena.ReleaseChunk(aligned);
+    auto* again = arena.RequestChunk(mPageSize, alignment);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(again->GetData()) % alignment, 0);
+}
+
+TEST_F(ArenaFixture, WHEN_free_chunks_are_misaligned_THEN_over_aligned_request_skips_them)
+{
+    Arena arena(mPageSize * 4);
+    std::vector<ArenaChunk*> chunks;
+    for (int i = 0; i < 8; ++i)
+    {
+        chunks.push_back(arena.RequestChunk(200));
+    }
+    for (int i = 0; i < 7; ++i)
+    {
+        arena.ReleaseChunk(chunks[i]);
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        auto* aligned = arena.RequestChunk(200, 512);
+        ASSERT_NE(aligned, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned->GetData()) % 512, 0);
+    }
+}
+
+TEST_F(ArenaFixture, WHEN_budget_is_exhausted_THEN_request_throws_and_arena_stays_usable)
+{
+    MemoryBudget budget(mPageSize * 2);
+    ArenaConfig config;
+    config.mBlockGrowthFactor = 1;
+    config.mBudget = &budget;
+    {
+        Arena arena(mPageSize, config);
+        ArenaChunk* first = arena.RequestChunk(mPageSize / 2);
+        arena.RequestChunk(mPageSize / 2);
+        EXPECT_EQ(budget.GetUsed(), mPageSize * 2);
+
+        EXPECT_THROW(arena.RequestChunk(mPageSize / 2), std::bad_alloc);
+        EXPECT_EQ(GetMemoryBlocks(arena).size(), 2);
+        EXPECT_EQ(budget.GetUsed(), mPageSize * 2);
+
+        // Chunks inside the charged blocks are still served
+        arena.ReleaseChunk(first);
+        EXPECT_NE(arena.RequestChunk(mPageSize / 2), nullptr);
+    }
+    EXPECT_EQ(budget.GetUsed(), 0);
+}
+
 }  // namespace Moon::Test
@@ -0,0 +1,301 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <MemoryLib/concurrentArena.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace Moon::Test
+{
+
+class ConcurrentArenaFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+    }
+
+    void TearDown() override {}
+
+    auto GetOwnerId(const ArenaChunk* chunk)
+    {
+        return static_cast<const ArenaChunkHeader*>(chunk)->mOwnerId;
+    }
+
+    auto IsChunkUsed(const ArenaChunk* chunk)
+    {
+        return static_cast<const ArenaChunkHeader*>(chunk)->mIsUsed;
+    }
+
+    auto GetRemoteFrees(ConcurrentArena& arena, const uint16_t ownerId)
+    {
+        return arena.mCaches[ownerId].load()->mRemoteFrees.load();
+    }
+
+    size_t GetThreadCacheCount(ConcurrentArena& arena)
+    {
+        std::lock_guard<std::mutex> lock(arena.mRegistryMutex);
+        return arena.mCacheStorage.size();
+    }
+
+    std::mutex& GetRegistryMutex(ConcurrentArena& arena)
+    {
+        return arena.mRegistryMutex;
+    }
+};
+
+TEST_F(ConcurrentArenaFixture, WHEN_chunks_are_requested_from_one_thread_THEN_one_cache_is_used)
+{
+    ConcurrentArena arena(4096);
+    auto* chunk1 = arena.RequestChunk(128);
+    auto* chunk2 = arena.RequestChunk(128);
+
+    EXPECT_NE(chunk1, chunk2);
+    EXPECT_EQ(GetOwnerId(chunk1), GetOwnerId(chunk2));
+    EXPECT_EQ(GetThreadCacheCount(arena), 1);
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_chunk_is_released_by_owner_THEN_it_is_reused)
+{
+    ConcurrentArena arena(4096);
+    auto* chunk1 = arena.RequestChunk(128);
+    arena.RequestChunk(128);
+    arena.ReleaseChunk(chunk1);
+
+    EXPECT_FALSE(IsChunkUsed(chunk1));
+    EXPECT_EQ(arena.RequestChunk(128), chunk1);
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_chunk_is_released_by_other_thread_THEN_owner_drains_it)
+{
+    ConcurrentArena arena(4096);
+    auto* chunk1 = arena.RequestChunk(128);
+    arena.RequestChunk(128);
+
+    std::thread([&] { arena.ReleaseChunk(chunk1); }).join();
+
+    EXPECT_TRUE(IsChunkUsed(chunk1));
+    EXPECT_EQ(GetRemoteFrees(arena, GetOwnerId(chunk1)), chunk1);
+
+    EXPECT_EQ(arena.RequestChunk(128), chunk1);
+    EXPECT_EQ(GetRemoteFrees(arena, GetOwnerId(chunk1)), nullptr);
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_threads_request_chunks_THEN_each_thread_gets_its_own_cache)
+{
+    ConcurrentArena arena(4096);
+    constexpr int threadCount = 8;
+    std::vector<ArenaChunk*> chunks(threadCount);
+    // Threads stay alive until all have requested, an exited thread's cache is reused
+    std::atomic<int> requested{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&, i] {
+            chunks[i] = arena.RequestChunk(256);
+            ++requested;
+            while (requested.load() < threadCount)
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<uint16_t> owners;
+    for (auto* chunk : chunks)
+    {
+        owners.insert(GetOwnerId(chunk));
+    }
+    EXPECT_EQ(owners.size(), threadCount);
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_threads_allocate_and_free_across_threads_THEN_no_chunk_is_shared)
+{
+    ConcurrentArena arena(4096);
+    constexpr int threadCount = 8;
+    constexpr int iterations = 2000;
+    std::vector<std::vector<ArenaChunk*>> handoff(threadCount);
+    std::atomic<bool> corrupted{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t] {
+            auto& mine = handoff[t];
+            for (int i = 0; i < iterations; ++i)
+            {
+                auto* chunk = arena.RequestChunk(64 + (i % 7) * 32);
+                auto* data = static_cast<int*>(chunk->GetData());
+                data[0] = t;
+                data[1] = i;
+                mine.push_back(chunk);
+                if (mine.size() > 16)
+                {
+                    auto* old = mine.front();
+                    mine.erase(mine.begin());
+                    auto* oldData = static_cast<int*>(old->GetData());
+                    if (oldData[0] != t)
+                    {
+                        corrupted = true;
+                    }
+                    arena.ReleaseChunk(old);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_FALSE(corrupted);
+
+    // Hand every remaining chunk to another thread to release
+    std::vector<std::thread> releasers;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        releasers.emplace_back([&, t] {
+            for (auto* chunk : handoff[(t + 1) % threadCount])
+            {
+                arena.ReleaseChunk(chunk);
+            }
+        });
+    }
+    for (auto& thread : releasers)
+    {
+        thread.join();
+    }
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_one_thread_alternates_between_arenas_THEN_no_lock_is_taken)
+{
+    ConcurrentArena arena1(4096);
+    ConcurrentArena arena2(4096);
+    std::promise<void> registered;
+    std::promise<void> locked;
+    std::promise<void> done;
+    auto doneFuture = done.get_future();
+
+    std::thread thread([&] {
+        arena1.ReleaseChunk(arena1.RequestChunk(64));
+        arena2.ReleaseChunk(arena2.RequestChunk(64));
+        registered.set_value();
+        locked.get_future().wait();
+        for (int i = 0; i < 1000; ++i)
+        {
+            auto& arena = i % 2 == 0 ? arena1 : arena2;
+            arena.ReleaseChunk(arena.RequestChunk(64));
+        }
+        done.set_value();
+    });
+
+    // Both registries stay locked while the thread switches between the arenas
+    registered.get_future().wait();
+    {
+        std::lock_guard<std::mutex> lock1(GetRegistryMutex(arena1));
+        std::lock_guard<std::mutex> lock2(GetRegistryMutex(arena2));
+        locked.set_value();
+        EXPECT_EQ(doneFuture.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    }
+    thread.join();
+    EXPECT_EQ(GetThreadCacheCount(arena1), 1);
+    EXPECT_EQ(GetThreadCacheCount(arena2), 1);
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_threads_exit_THEN_their_caches_are_reused)
+{
+    ConcurrentArena arena(4096);
+    for (size_t i = 0; i < ConcurrentArena::MAX_THREAD_CACHES + 8; ++i)
+    {
+        std::thread([&] { arena.ReleaseChunk(arena.RequestChunk(64)); }).join();
+    }
+    EXPECT_EQ(GetThreadCacheCount(arena), 1);
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_threads_only_release_chunks_THEN_they_take_no_cache)
+{
+    ConcurrentArena arena(4096);
+    constexpr size_t threadCount = ConcurrentArena::MAX_THREAD_CACHES + 8;
+    std::vector<ArenaChunk*> chunks(threadCount);
+    for (auto*& chunk : chunks)
+    {
+        chunk = arena.RequestChunk(64);
+    }
+
+    // Every releaser stays alive until all have released, no cache can be reused
+    std::atomic<size_t> released{0};
+    std::vector<std::thread> releasers;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        releasers.emplace_back([&, i] {
+            arena.ReleaseChunk(chunks[i]);
+            ++released;
+            while (released.load() < threadCount)
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& thread : releasers)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(GetThreadCacheCount(arena), 1);
+
+    // The owner drains all of them on its next request
+    arena.ReleaseChunk(arena.RequestChunk(64));
+    for (auto* chunk : chunks)
+    {
+        EXPECT_FALSE(IsChunkUsed(chunk));
+    }
+}
+
+TEST_F(ConcurrentArenaFixture, WHEN_owner_thread_has_exited_THEN_its_chunks_are_still_freed)
+{
+    ConcurrentArena arena(4096);
+    ArenaChunk* releasedBeforeExit = nullptr;
+    ArenaChunk* releasedAfterExit = nullptr;
+    ArenaChunk* kept = nullptr;
+    std::promise<void> requested;
+    std::promise<void> released;
+    std::thread owner([&] {
+        releasedBeforeExit = arena.RequestChunk(128);
+        releasedAfterExit = arena.RequestChunk(128);
+        kept = arena.RequestChunk(128);
+        requested.set_value();
+        released.get_future().wait();
+    });
+
+    requested.get_future().wait();
+    arena.ReleaseChunk(releasedBeforeExit);
+    EXPECT_TRUE(IsChunkUsed(releasedBeforeExit));
+    released.set_value();
+    owner.join();
+
+    // The exiting thread drained the first, the second goes straight back
+    EXPECT_FALSE(IsChunkUsed(releasedBeforeExit));
+    arena.ReleaseChunk(releasedAfterExit);
+    EXPECT_FALSE(IsChunkUsed(releasedAfterExit));
+    EXPECT_EQ(GetRemoteFrees(arena, GetOwnerId(kept)), nullptr);
+
+    // The next thread adopts the cache along with the chunk still in use
+    std::thread([&] {
+        EXPECT_EQ(arena.RequestChunk(128), releasedBeforeExit);
+        arena.ReleaseChunk(kept);
+    }).join();
+    EXPECT_FALSE(IsChunkUsed(kept));
+    // The releasing main thread never took a cache
+    EXPECT_EQ(GetThreadCacheCount(arena), 1);
+}
+
+}  // namespace Moon::Test
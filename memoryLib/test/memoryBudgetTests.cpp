@@ -0,0 +1,98 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <MemoryLib/memoryBudget.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace Moon::Test
+{
+
+TEST(MemoryBudgetTest, WHEN_bytes_are_charged_and_released_THEN_usage_follows)
+{
+    MemoryBudget budget(1000);
+    EXPECT_TRUE(budget.TryCharge(400));
+    EXPECT_TRUE(budget.TryCharge(600));
+    EXPECT_EQ(budget.GetUsed(), 1000);
+
+    budget.Release(400);
+    EXPECT_EQ(budget.GetUsed(), 600);
+}
+
+TEST(MemoryBudgetTest, WHEN_hard_limit_would_be_exceeded_THEN_nothing_is_charged)
+{
+    MemoryBudget budget(1000);
+    EXPECT_TRUE(budget.TryCharge(900));
+    EXPECT_FALSE(budget.TryCharge(101));
+    EXPECT_EQ(budget.GetUsed(), 900);
+    EXPECT_THROW(budget.Charge(200), std::bad_alloc);
+    EXPECT_EQ(budget.GetUsed(), 900);
+}
+
+TEST(MemoryBudgetTest, WHEN_hard_limit_is_zero_THEN_budget_is_unlimited)
+{
+    MemoryBudget budget(0);
+    EXPECT_TRUE(budget.TryCharge(SIZE_MAX / 2));
+}
+
+TEST(MemoryBudgetTest, WHEN_soft_limit_is_crossed_THEN_callback_runs_once_per_crossing)
+{
+    int calls = 0;
+    MemoryBudget budget(0, 500, [&calls](const MemoryBudget& b) {
+        ++calls;
+        EXPECT_GT(b.GetUsed(), b.GetSoftLimit());
+    });
+
+    budget.Charge(500);
+    EXPECT_EQ(calls, 0);
+    budget.Charge(1);
+    budget.Charge(100);
+    EXPECT_EQ(calls, 1);
+
+    budget.Release(200);
+    budget.Charge(200);
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(MemoryBudgetTest, WHEN_callback_releases_memory_THEN_usage_drops_below_soft_limit)
+{
+    MemoryBudget* self = nullptr;
+    MemoryBudget budget(0, 100, [&self](const MemoryBudget&) { self->Release(50); });
+    self = &budget;
+
+    budget.Charge(120);
+    EXPECT_EQ(budget.GetUsed(), 70);
+}
+
+TEST(MemoryBudgetTest, WHEN_threads_charge_concurrently_THEN_usage_never_exceeds_hard_limit)
+{
+    constexpr size_t limit = 64 * 1000;
+    MemoryBudget budget(limit);
+    std::vector<std::thread> threads;
+    std::atomic<size_t> charged{0};
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 10000; ++i)
+            {
+                if (budget.TryCharge(64))
+                {
+                    charged.fetch_add(64);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(budget.GetUsed(), limit);
+    EXPECT_EQ(budget.GetUsed(), charged.load());
+}
+
+}  // namespace Moon::Test
@@ -0,0 +1,126 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <MemoryLib/objectArena.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Moon::Test
+{
+
+class ObjectArenaFixture : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ::testing::GTEST_FLAG(throw_on_failure) = true;
+        ::testing::InitGoogleMock();
+        Tracked::sDestroyed.clear();
+        Tracked::sThrowOnValue = -1;
+    }
+
+    struct Tracked
+    {
+        Tracked(const int value) : mValue(value)
+        {
+            if (value == sThrowOnValue)
+            {
+                throw std::runtime_error("Tracked(): requested failure");
+            }
+        }
+        ~Tracked()
+        {
+            sDestroyed.push_back(mValue);
+        }
+
+        int mValue;
+
+        static inline std::vector<int> sDestroyed;
+        static inline int sThrowOnValue = -1;
+    };
+
+    struct alignas(128) Wide
+    {
+        int mValue;
+    };
+};
+
+TEST_F(ObjectArenaFixture, WHEN_objects_are_created_THEN_runs_are_contiguous)
+{
+    ObjectArena<int> arena(16);
+    int* first = arena.Create(0);
+    for (int i = 1; i < 16; ++i)
+    {
+        EXPECT_EQ(arena.Create(i), first + i);
+    }
+    EXPECT_EQ(arena.Size(), 16);
+    EXPECT_EQ(first[15], 15);
+}
+
+TEST_F(ObjectArenaFixture, WHEN_create_n_is_called_THEN_all_objects_are_built_from_the_args)
+{
+    ObjectArena<int> arena(8);
+    arena.Create(1);
+    int* batch = arena.CreateN(100, 42);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(batch[i], 42);
+    }
+    EXPECT_EQ(arena.Size(), 101);
+    EXPECT_EQ(arena.CreateN(0, 1), nullptr);
+}
+
+TEST_F(ObjectArenaFixture, WHEN_arena_dies_THEN_objects_are_destroyed_in_creation_order)
+{
+    {
+        ObjectArena<Tracked> arena(4);
+        arena.Create(0);
+        arena.CreateN(3, 1);
+        arena.CreateN(6, 2);
+        arena.Create(3);
+        EXPECT_TRUE(Tracked::sDestroyed.empty());
+    }
+
+    const std::vector<int> expected{0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3};
+    EXPECT_EQ(Tracked::sDestroyed, expected);
+}
+
+TEST_F(ObjectArenaFixture, WHEN_constructor_throws_in_create_n_THEN_partial_batch_is_destroyed)
+{
+    ObjectArena<Tracked> arena(4);
+    arena.Create(0);
+    Tracked::sThrowOnValue = 7;
+    EXPECT_THROW(arena.CreateN(3, 7), std::runtime_error);
+    EXPECT_EQ(arena.Size(), 1);
+    EXPECT_TRUE(Tracked::sDestroyed.empty());
+
+    Tracked::sThrowOnValue = -1;
+    EXPECT_EQ(arena.Create(1)->mValue, 1);
+    EXPECT_EQ(arena.Size(), 2);
+}
+
+TEST_F(ObjectArenaFixture, WHEN_arena_is_cleared_THEN_objects_are_destroyed_and_memory_reused)
+{
+    ObjectArena<Tracked> arena(4);
+    Tracked* first = arena.Create(0);
+    arena.Create(1);
+    arena.Clear();
+
+    EXPECT_EQ(Tracked::sDestroyed.size(), 2);
+    EXPECT_EQ(arena.Size(), 0);
+    EXPECT_EQ(arena.Create(2), first);
+}
+
+TEST_F(ObjectArenaFixture, WHEN_type_is_over_aligned_THEN_objects_are_aligned)
+{
+    ObjectArena<Wide> arena(3);
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(arena.Create()) % 128, 0);
+    }
+    static_assert(std::is_trivially_destructible_v<Wide>);
+}
+
+}  // namespace Moon::Test
@@ -0,0 +1,53 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <MemoryLib/pageAllocator.hpp>
+
+#include <cstring>
+
+namespace Moon::Test
+{
+
+TEST(PageAllocatorTest, WHEN_page_size_is_queried_THEN_power_of_two_is_returned)
+{
+    const auto pageSize = PageAllocator::GetPageSize();
+    EXPECT_GT(pageSize, 0);
+    EXPECT_EQ(pageSize & (pageSize - 1), 0);
+}
+
+TEST(PageAllocatorTest, WHEN_pages_are_mapped_THEN_memory_is_writable_and_zeroed)
+{
+    const auto size = PageAllocator::GetPageSize() * 4;
+    std::byte* ptr = PageAllocator::Map(size);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(ptr[0], std::byte{0});
+    EXPECT_EQ(ptr[size - 1], std::byte{0});
+
+    std::memset(ptr, 0x5A, size);
+    EXPECT_EQ(ptr[size - 1], std::byte{0x5A});
+    PageAllocator::Unmap(ptr, size);
+}
+
+TEST(PageAllocatorTest, WHEN_pages_are_discarded_THEN_memory_reads_back_as_zero)
+{
+    const auto size = PageAllocator::GetPageSize() * 2;
+    std::byte* ptr = PageAllocator::Map(size);
+    std::memset(ptr, 0x5A, size);
+
+    PageAllocator::Discard(ptr, size);
+
+    EXPECT_EQ(ptr[0], std::byte{0});
+    EXPECT_EQ(ptr[size - 1], std::byte{0});
+    PageAllocator::Unmap(ptr, size);
+}
+
+TEST(PageAllocatorTest, WHEN_huge_pages_are_requested_THEN_mapping_succeeds_with_fallback)
+{
+    const auto size = PageAllocator::HUGE_PAGE_SIZE;
+    std::byte* ptr = PageAllocator::Map(size, true);
+    ASSERT_NE(ptr, nullptr);
+    ptr[size - 1] = std::byte{1};
+    PageAllocator::Unmap(ptr, size);
+}
+
+}  // namespace Moon::Test
@@ -13,7 +13,7 @@ class Vector : Allocator
     using Iterator = VectorIterator<T>;
 
    public:
-    Vector(Allocator allocator = Allocator()) noexcept
+    Vector(Allocator allocator = Allocator())
         : Allocator(std::move(allocator)),
           mCapacity(Allocator::GetStartingCapacity()),
           mElemCount(0),
@@ -21,7 +21,7 @@ class Vector : Allocator
     {
     }
 
-    Vector(const size_t size, const T& elem = T(), Allocator allocator = Allocator()) noexcept
+    Vector(const size_t size, const T& elem = T(), Allocator allocator = Allocator())
         : Allocator(std::move(allocator)),
           mCapacity(Allocator::GetNewCapacity(size)),
           mElemCount(size),
@@ -34,7 +34,7 @@ class Vector : Allocator
     }
 
     Vector(const VectorIterator<T>& begin,
-           const VectorIterator<T>& end, Allocator allocator = Allocator()) noexcept
+           const VectorIterator<T>& end, Allocator allocator = Allocator())
         : Allocator(std::move(allocator)),
           mCapacity(Allocator::GetNewCapacity(end - begin)),
           mElemCount(end - begin),
@@ -49,10 +49,10 @@ class Vector : Allocator
     // NOTE: The templated constructor is not qualified to be a copy constructor
     // because it is a template, hence why, this constructor is still needed.
     // THIS APPLIES TO ALL THE OTHER DEFAULT CLASS FUNCTIONS
-    Vector(const Vector& other) noexcept : Vector(other.Begin(), other.End()) {}
+    Vector(const Vector& other) : Vector(other.Begin(), other.End()) {}
 
     template <typename OtherAllocator>
-    Vector(const Vector<T, OtherAllocator>& other) noexcept
+    Vector(const Vector<T, OtherAllocator>& other)
         : Vector(other.Begin(), other.End())
     {
     }
@@ -93,6 +93,7 @@ class Vector : Allocator
         if (this != &other)
         {
             Clear();
+            Allocator::Deallocate(mHead);
             mHead = other.mHead;
             mCapacity = other.mCapacity;
             mElemCount = other.mElemCount;
@@ -1,4 +1,5 @@
 #pragma once
+#include <AllocatorLib/allocatorTraits.hpp>
 #include <VectorLib/vectorIterator.hpp>
 #include <cassert>
 #include <stdexcept>
@@ -122,6 +123,16 @@ void Vector<T, Allocator>::Reallocate(size_t newCapacity, size_t startOffset)
 {
     assert(startOffset + mElemCount <= newCapacity &&
            "Reallocate(): Impl error");
+
+    if constexpr (SupportsTryExtend<Allocator>::value)
+    {
+        if (startOffset == 0 && mHead && this->Allocator::TryExtend(mHead, newCapacity))
+        {
+            mCapacity = newCapacity;
+            return;
+        }
+    }
+
     T* newHead = this->Allocator::Allocate(newCapacity);
 
     for (int i = 0; i < mElemCount; ++i)
@@ -141,9 +152,9 @@ void Vector<T, Allocator>::AssignFrom(const Vector& other)
 {
     // TODO: figure out how to assign allocators
     Clear();
-    this->Allocator::Deallocate(mHead);
     if (mCapacity < other.mElemCount)
     {
+        this->Allocator::Deallocate(mHead);
         const size_t newCapacity = this->Allocator::GetNewCapacity(other.mElemCount);
         mHead = this->Allocator::Allocate(newCapacity);
         mCapacity = newCapacity;
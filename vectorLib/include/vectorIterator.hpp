@@ -1,6 +1,8 @@
 #pragma once
 
 #include <AllocatorLib/heapAllocator.hpp>
+#include <cstddef>
+#include <type_traits>
 
 namespace Moon
 {
@@ -13,12 +15,18 @@ template <typename T>
 class VectorIterator
 {
    public:
+    // Lets a VectorIterator<T> be passed where a VectorIterator<const T> is expected
+    template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+    VectorIterator(const VectorIterator<U>& other) noexcept : mPtr(other.mPtr)
+    {
+    }
+
     VectorIterator& operator++() noexcept; 
     VectorIterator operator++(int) noexcept; 
     VectorIterator& operator--() noexcept; 
     VectorIterator operator--(int) noexcept; 
-    VectorIterator operator+(int offset) const noexcept;
-    VectorIterator operator-(int offset) const noexcept;
+    VectorIterator operator+(std::ptrdiff_t offset) const noexcept;
+    VectorIterator operator-(std::ptrdiff_t offset) const noexcept;
     size_t operator-(const VectorIterator& other) const noexcept;
 
     bool operator==(const VectorIterator& other) const noexcept;
@@ -37,6 +45,8 @@ class VectorIterator
 
     template <typename U, typename Allocator>
     friend class Vector;  
+    template <typename U>
+    friend class VectorIterator;
 };
 }  // namespace Moon
 
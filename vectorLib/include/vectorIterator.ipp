@@ -33,13 +33,13 @@ VectorIterator<T> VectorIterator<T>::operator--(int) noexcept
 }
 
 template <typename T>
-VectorIterator<T> VectorIterator<T>::operator+(int offset) const noexcept
+VectorIterator<T> VectorIterator<T>::operator+(std::ptrdiff_t offset) const noexcept
 {
     return VectorIterator<T>{mPtr + offset};
 }
 
 template <typename T>
-VectorIterator<T> VectorIterator<T>::operator-(int offset) const noexcept
+VectorIterator<T> VectorIterator<T>::operator-(std::ptrdiff_t offset) const noexcept
 {
     return VectorIterator<T>{mPtr - offset};
 }
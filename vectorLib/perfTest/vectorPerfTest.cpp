@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <AllocatorLib/arenaAllocator.hpp>
+#include <MemoryLib/arenaScope.hpp>
 #include <VectorLib/vector.hpp>
 
 static void CustomArguments(benchmark::internal::Benchmark* b)
@@ -21,6 +23,23 @@ static void BM_MoonVectorPushBack(benchmark::State& state)
     state.SetItemsProcessed(state.iterations() * state.range(0));
 }
 
+static void BM_ArenaVectorPushBack(benchmark::State& state)
+{
+    Moon::Arena arena(1024 * 1024);
+    for (auto _ : state)
+    {
+        Moon::ArenaScope scope(arena);
+        Moon::ArenaAllocator<int> allocator(&arena);
+        Moon::Vector<int, Moon::ArenaAllocator<int>> vec(allocator);
+        for (int i = 0; i < state.range(0); ++i)
+        {
+            vec.PushBack(i);
+        }
+        state.counters["Capacity"] = vec.Capacity();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
 static void BM_StdVectorPushBack(benchmark::State& state)
 {
     for (auto _ : state)
@@ -154,6 +173,7 @@ static void BM_StdVectorEmplaceBack(benchmark::State& state)
 }
 
 BENCHMARK(BM_MoonVectorPushBack)->Apply(CustomArguments);
+BENCHMARK(BM_ArenaVectorPushBack)->Apply(CustomArguments);
 BENCHMARK(BM_StdVectorPushBack)->Apply(CustomArguments);
 BENCHMARK(BM_MoonVectorIteration)->Apply(CustomArguments);
 BENCHMARK(BM_MoonVectorRandomAccess)->Apply(CustomArguments);
@@ -5,6 +5,8 @@
 #include <VectorLib/vector.hpp>
 #include <AllocatorLib/arenaAllocator.hpp>
 
+#include <vector>
+
 namespace Moon::Test
 {
 using Dummy = Moon::Common::Test::Dummy;
@@ -115,6 +117,92 @@ TEST_F(ArenaVectorFixture, WHEN_elements_are_accessed_via_iterator_THEN_elements
     EXPECT_EQ(index, 3);
     BlockExpectations();
 }
+TEST_F(ArenaVectorFixture, WHEN_vector_grows_at_end_of_block_THEN_elements_are_not_moved)
+{
+    Arena arena(1024);
+    ArenaAllocator<Dummy> allocator(&arena);
+    ArenaVector<Dummy> vec(allocator);
+
+    EXPECT_CALL(*dummyTracker, MoveConstructor()).Times(100);
+    for (int i = 0; i < 100; ++i)
+    {
+        vec.PushBack(Dummy(i));
+    }
+    BlockExpectations();
+
+    const auto* head = &vec[0];
+    EXPECT_CALL(*dummyTracker, MoveConstructor()).Times(100);
+    for (int i = 100; i < 200; ++i)
+    {
+        vec.PushBack(Dummy(i));
+    }
+    BlockExpectations();
+
+    EXPECT_EQ(&vec[0], head);
+    for (int i = 0; i < 200; ++i)
+    {
+        EXPECT_EQ(vec[i].value, i);
+    }
+}
+
+TEST_F(ArenaVectorFixture, WHEN_vector_can_not_grow_in_place_THEN_elements_are_moved_to_new_chunk)
+{
+    Arena arena(1024);
+    ArenaAllocator<Dummy> allocator(&arena);
+    ArenaAllocator<Dummy> otherAllocator(&arena);
+    ArenaVector<Dummy> vec(allocator);
+    ArenaVector<Dummy> blocker(otherAllocator);
+
+    vec.PushBack(Dummy(10));
+    vec.PushBack(Dummy(20));
+    const auto* head = &vec[0];
+    // Another chunk now sits right behind vec's chunk
+    blocker.PushBack(Dummy(1));
+
+    for (int i = 0; i < 20; ++i)
+    {
+        vec.PushBack(Dummy(i));
+    }
+
+    EXPECT_NE(&vec[0], head);
+    EXPECT_EQ(vec.Size(), 22);
+    EXPECT_EQ(vec[0].value, 10);
+    EXPECT_EQ(vec[1].value, 20);
+    EXPECT_EQ(vec[21].value, 19);
+    EXPECT_EQ(blocker[0].value, 1);
+    BlockExpectations();
+}
+
+TEST_F(ArenaVectorFixture, WHEN_many_vectors_share_one_allocator_THEN_each_keeps_its_own_elements)
+{
+    Arena arena(1024);
+    ArenaAllocator<Dummy> allocator(&arena);
+    std::vector<ArenaVector<Dummy>> vecs;
+    for (int v = 0; v < 8; ++v)
+    {
+        vecs.emplace_back(allocator);
+    }
+
+    // Interleaved growth forces most reallocations to move to a new chunk
+    for (int i = 0; i < 50; ++i)
+    {
+        for (int v = 0; v < 8; ++v)
+        {
+            vecs[v].PushBack(Dummy(v * 100 + i));
+        }
+    }
+
+    for (int v = 0; v < 8; ++v)
+    {
+        ASSERT_EQ(vecs[v].Size(), 50);
+        for (int i = 0; i < 50; ++i)
+        {
+            EXPECT_EQ(vecs[v][i].value, v * 100 + i);
+        }
+    }
+    BlockExpectations();
+}
+
 //
 // TEST_F(ArenaVectorFixture, WHEN_vector_is_resized_smaller_THEN_excess_elements_are_removed)
 // {
@@ -1,6 +1,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <AllocatorLib/budgetAllocator.hpp>
 #include <AllocatorLib/debugAllocator.hpp>
 #include <AllocatorLib/heapAllocator.hpp>
 #include <CommonTestLib/dummy.hpp>
@@ -362,4 +363,61 @@ TEST_F(
     BlockExpectations();
 }
 
+TEST_F(VectorFixture, WHEN_vector_is_assigned_over_one_with_elements_THEN_old_buffer_is_released)
+{
+    DebugVector<Dummy> source;
+    source.PushBack(Dummy(1));
+    source.PushBack(Dummy(2));
+
+    // Room for both elements, the copy reuses the buffer
+    DebugVector<Dummy> copied;
+    copied.Reserve(4);
+    copied.PushBack(Dummy(3));
+    copied = source;
+    EXPECT_EQ(copied.Size(), 2);
+    EXPECT_EQ(copied[1].value, 2);
+
+    DebugVector<Dummy> moved;
+    moved.PushBack(Dummy(4));
+    moved = std::move(copied);
+    EXPECT_EQ(moved.Size(), 2);
+    EXPECT_EQ(moved[0].value, 1);
+    // TearDown reports the buffers still allocated
+}
+
+TEST_F(VectorFixture, WHEN_allocator_is_over_aligned_THEN_data_stays_aligned_across_growth)
+{
+    Vector<float, HeapAllocator<float, 64>> vector;
+    for (int i = 0; i < 1000; ++i)
+    {
+        vector.PushBack(static_cast<float>(i));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(&vector[0]) % 64, 0);
+    }
+    EXPECT_EQ(vector[999], 999.0f);
+}
+
+TEST_F(VectorFixture, WHEN_budget_is_exhausted_THEN_push_back_throws_and_elements_are_kept)
+{
+    MemoryBudget budget(256);
+    BudgetAllocator<int> allocator(&budget);
+    Vector<int, BudgetAllocator<int>> vector(allocator);
+    size_t pushed = 0;
+    try
+    {
+        while (true)
+        {
+            vector.PushBack(static_cast<int>(pushed));
+            ++pushed;
+        }
+    }
+    catch (const std::bad_alloc&)
+    {
+    }
+
+    EXPECT_GT(pushed, 0);
+    EXPECT_EQ(vector.Size(), pushed);
+    EXPECT_EQ(vector[pushed - 1], static_cast<int>(pushed - 1));
+    EXPECT_LE(budget.GetUsed(), budget.GetHardLimit());
+}
+
 }  // namespace Moon::Test